@@ -1,5 +1,6 @@
 #ifndef SRC_NODE_H_
 #define SRC_NODE_H_
+#include <utility>
 namespace sfleta_ {
 template <typename T>
 class Node {
@@ -9,6 +10,9 @@ class Node {
   Node *pPrev_;
   Node(): data_(), pNext_(nullptr), pPrev_(nullptr) {}
   explicit Node(const T &data) : Node() {data_ = data;}
+  template <typename... Args>
+  explicit Node(std::in_place_t, Args &&...args)
+      : data_(std::forward<Args>(args)...), pNext_(nullptr), pPrev_(nullptr) {}
 };
 }  // namespace sfleta_
 #endif  // SRC_NODE_H_
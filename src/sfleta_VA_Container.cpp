@@ -7,11 +7,6 @@ typename VA_Container<T>::reference VA_Container<T>::at(size_type pos) const {
     return buffer_[pos];
 }
 
-template<typename T>
-typename VA_Container<T>::reference VA_Container<T>::operator[](size_type pos) {
-    return at(pos);
-}
-
 template<typename T>
 typename VA_Container<T>::const_reference VA_Container<T>::front() {
     if (empty()) {
@@ -42,9 +37,4 @@ template<typename T>
 typename VA_Container<T>::iterator VA_Container<T>::end() {
     return buffer_ + size_;
 }
-
-template<typename T>
-bool VA_Container<T>::empty() {
-    return size_ == 0;
-}
 }  // namespace sfleta_
@@ -1,6 +1,8 @@
 #ifndef SRC_sfleta_VA_CONTAINER_H_
 #define SRC_sfleta_VA_CONTAINER_H_
+#include <cassert>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
 #include <cmath>
 
@@ -20,19 +22,29 @@ class VA_Container {
     size_type size_;
 
  public:
+    // Non-virtual on purpose: accessors inline into loops over the derived
+    // containers, which keep size_ equal to their logical size.
     VA_Container() : buffer_(nullptr), size_(0) {}
-    virtual reference at(size_type pos) const;
-    reference operator[](size_type pos);
+    reference at(size_type pos) const;
+    // unchecked, out of range access is only caught by assert in debug builds
+    reference operator[](size_type pos) noexcept {
+        assert(pos < size_);
+        return buffer_[pos];
+    }
+    const_reference operator[](size_type pos) const noexcept {
+        assert(pos < size_);
+        return buffer_[pos];
+    }
     const_reference front();
-    virtual const_reference back();
+    const_reference back();
     iterator data() const;
 
     iterator begin();
-    virtual iterator end();
+    iterator end();
 
-    bool empty();
-    virtual size_type size() const { return size_; }
-    virtual size_type max_size() { return std::numeric_limits<size_type>::max() / 2 / sizeof(value_type); }
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+    size_type max_size() const { return std::numeric_limits<size_type>::max() / 2 / sizeof(value_type); }
 };
 }  // namespace sfleta_
 #include "sfleta_VA_Container.cpp"
@@ -1,9 +1,15 @@
 #ifndef SRC_sfleta_ARRAY_H_
 #define SRC_sfleta_ARRAY_H_
-#include "sfleta_VA_Container.h"
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 namespace sfleta_ {
+// Fixed-size array with inline storage. It is an aggregate, so it is
+// initialized with braces, copies like a plain struct and is trivially
+// copyable whenever T is.
 template <typename T, size_t N>
-class array : public VA_Container<T> {
+class array {
  public:
     using value_type = T;
     using reference = T&;
@@ -12,25 +18,32 @@ class array : public VA_Container<T> {
     using const_iterator = const T*;
     using size_type = size_t;
 
- private:
-    void remove_array();
+    // public so that the class stays an aggregate, one spare slot keeps N == 0 legal
+    value_type elems_[N ? N : 1];
 
- public:
-    array();
-    explicit array(std::initializer_list<value_type> const& items);
-    explicit array(const array& v);
-    explicit array(array&& v);
-    ~array();
-    array& operator=(array&& v);
+    constexpr reference at(size_type pos);
+    constexpr const_reference at(size_type pos) const;
+    constexpr reference operator[](size_type pos) noexcept { return elems_[pos]; }
+    constexpr const_reference operator[](size_type pos) const noexcept { return elems_[pos]; }
+    constexpr reference front() noexcept { return elems_[0]; }
+    constexpr const_reference front() const noexcept { return elems_[0]; }
+    constexpr reference back() noexcept { return elems_[N ? N - 1 : 0]; }
+    constexpr const_reference back() const noexcept { return elems_[N ? N - 1 : 0]; }
+    constexpr iterator data() noexcept { return elems_; }
+    constexpr const_iterator data() const noexcept { return elems_; }
+
+    constexpr iterator begin() noexcept { return elems_; }
+    constexpr const_iterator begin() const noexcept { return elems_; }
+    constexpr iterator end() noexcept { return elems_ + N; }
+    constexpr const_iterator end() const noexcept { return elems_ + N; }
 
-    void swap(array& other);
-    void fill(const_reference value);
+    // static: the answer never depends on the (possibly uninitialized) elements
+    static constexpr bool empty() noexcept { return N == 0; }
+    static constexpr size_type size() noexcept { return N; }
+    static constexpr size_type max_size() noexcept { return N; }
 
-    const_reference back() override { return this->operator[](N - 1); }
-    reference at(size_type pos) const override;
-    iterator end() override;
-    size_type max_size() override { return N; }
-    size_type size() const override { return N; }
+    constexpr void fill(const_reference value);
+    constexpr void swap(array& other) noexcept(std::is_nothrow_swappable_v<T>);
 };
 }  // namespace sfleta_
 #include "sfleta_array.cpp"
@@ -0,0 +1,641 @@
+namespace sfleta_ {
+template <typename K>
+typename std::enable_if<std::is_integral<K>::value, std::string>::type ArtEncodeKey(const K& key) {
+    using U = typename std::make_unsigned<K>::type;
+    U bits = static_cast<U>(key);
+    if (std::is_signed<K>::value) {
+        bits ^= U(1) << (sizeof(K) * 8 - 1);
+    }
+    std::string bytes(sizeof(K), '\0');
+    for (size_t i = 0; i < sizeof(K); ++i) {
+        bytes[sizeof(K) - 1 - i] = static_cast<char>((bits >> (8 * i)) & 0xFF);
+    }
+    return bytes;
+}
+
+inline ArtNode** ArtFindChild(ArtInner* node, uint8_t byte) {
+    switch (node->type_) {
+        case kArtNode4: {
+            ArtNode4* n = static_cast<ArtNode4*>(node);
+            for (int i = 0; i < n->count_; ++i) {
+                if (n->keys_[i] == byte) return &n->children_[i];
+            }
+            return nullptr;
+        }
+        case kArtNode16: {
+            ArtNode16* n = static_cast<ArtNode16*>(node);
+#if defined(__SSE2__)
+            __m128i cmp = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)),
+                                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(n->keys_)));
+            int mask = _mm_movemask_epi8(cmp) & ((1 << n->count_) - 1);
+            return mask ? &n->children_[__builtin_ctz(mask)] : nullptr;
+#else
+            for (int i = 0; i < n->count_; ++i) {
+                if (n->keys_[i] == byte) return &n->children_[i];
+            }
+            return nullptr;
+#endif
+        }
+        case kArtNode48: {
+            ArtNode48* n = static_cast<ArtNode48*>(node);
+            return n->index_[byte] ? &n->children_[n->index_[byte] - 1] : nullptr;
+        }
+        default: {
+            ArtNode256* n = static_cast<ArtNode256*>(node);
+            return n->children_[byte] ? &n->children_[byte] : nullptr;
+        }
+    }
+}
+
+inline ArtNode* ArtChildAt(ArtInner* node, uint8_t byte) {
+    ArtNode** ref = ArtFindChild(node, byte);
+    return ref ? *ref : nullptr;
+}
+
+// Smallest key byte greater than after that has a child, -1 if none.
+inline int ArtNextByte(const ArtInner* node, int after) {
+    switch (node->type_) {
+        case kArtNode4: {
+            const ArtNode4* n = static_cast<const ArtNode4*>(node);
+            for (int i = 0; i < n->count_; ++i) {
+                if (n->keys_[i] > after) return n->keys_[i];
+            }
+            return -1;
+        }
+        case kArtNode16: {
+            const ArtNode16* n = static_cast<const ArtNode16*>(node);
+            for (int i = 0; i < n->count_; ++i) {
+                if (n->keys_[i] > after) return n->keys_[i];
+            }
+            return -1;
+        }
+        case kArtNode48: {
+            const ArtNode48* n = static_cast<const ArtNode48*>(node);
+            for (int b = after + 1; b < 256; ++b) {
+                if (n->index_[b]) return b;
+            }
+            return -1;
+        }
+        default: {
+            const ArtNode256* n = static_cast<const ArtNode256*>(node);
+            for (int b = after + 1; b < 256; ++b) {
+                if (n->children_[b]) return b;
+            }
+            return -1;
+        }
+    }
+}
+
+inline void ArtDeleteInner(ArtInner* node) {
+    switch (node->type_) {
+        case kArtNode4: delete static_cast<ArtNode4*>(node); break;
+        case kArtNode16: delete static_cast<ArtNode16*>(node); break;
+        case kArtNode48: delete static_cast<ArtNode48*>(node); break;
+        default: delete static_cast<ArtNode256*>(node); break;
+    }
+}
+
+inline void ArtMoveHeader(ArtInner* from, ArtInner* to) {
+    to->count_ = from->count_;
+    to->prefix_ = std::move(from->prefix_);
+    to->leaf_ = from->leaf_;
+}
+
+template <typename Node>
+void ArtInsertSorted(Node* n, uint8_t byte, ArtNode* child) {
+    int i = n->count_;
+    while (i > 0 && n->keys_[i - 1] > byte) {
+        n->keys_[i] = n->keys_[i - 1];
+        n->children_[i] = n->children_[i - 1];
+        --i;
+    }
+    n->keys_[i] = byte;
+    n->children_[i] = child;
+    n->count_++;
+}
+
+// Adds a child under *ref, replacing *ref with the next node size when full.
+inline void ArtAddChild(ArtNode** ref, uint8_t byte, ArtNode* child) {
+    ArtInner* node = static_cast<ArtInner*>(*ref);
+    switch (node->type_) {
+        case kArtNode4: {
+            ArtNode4* n = static_cast<ArtNode4*>(node);
+            if (n->count_ < 4) {
+                ArtInsertSorted(n, byte, child);
+                return;
+            }
+            ArtNode16* grown = new ArtNode16();
+            ArtMoveHeader(n, grown);
+            for (int i = 0; i < 4; ++i) {
+                grown->keys_[i] = n->keys_[i];
+                grown->children_[i] = n->children_[i];
+            }
+            ArtInsertSorted(grown, byte, child);
+            *ref = grown;
+            delete n;
+            return;
+        }
+        case kArtNode16: {
+            ArtNode16* n = static_cast<ArtNode16*>(node);
+            if (n->count_ < 16) {
+                ArtInsertSorted(n, byte, child);
+                return;
+            }
+            ArtNode48* grown = new ArtNode48();
+            ArtMoveHeader(n, grown);
+            for (int i = 0; i < 16; ++i) {
+                grown->children_[i] = n->children_[i];
+                grown->index_[n->keys_[i]] = i + 1;
+            }
+            grown->children_[16] = child;
+            grown->index_[byte] = 17;
+            grown->count_++;
+            *ref = grown;
+            delete n;
+            return;
+        }
+        case kArtNode48: {
+            ArtNode48* n = static_cast<ArtNode48*>(node);
+            if (n->count_ < 48) {
+                int slot = 0;
+                while (n->children_[slot]) ++slot;
+                n->children_[slot] = child;
+                n->index_[byte] = slot + 1;
+                n->count_++;
+                return;
+            }
+            ArtNode256* grown = new ArtNode256();
+            ArtMoveHeader(n, grown);
+            for (int b = 0; b < 256; ++b) {
+                if (n->index_[b]) grown->children_[b] = n->children_[n->index_[b] - 1];
+            }
+            grown->children_[byte] = child;
+            grown->count_++;
+            *ref = grown;
+            delete n;
+            return;
+        }
+        default: {
+            ArtNode256* n = static_cast<ArtNode256*>(node);
+            n->children_[byte] = child;
+            n->count_++;
+            return;
+        }
+    }
+}
+
+// Removes the child slot for byte, replacing *ref with a smaller node when sparse.
+inline void ArtRemoveChild(ArtNode** ref, uint8_t byte) {
+    ArtInner* node = static_cast<ArtInner*>(*ref);
+    switch (node->type_) {
+        case kArtNode4:
+        case kArtNode16: {
+            uint8_t* keys;
+            ArtNode** children;
+            if (node->type_ == kArtNode4) {
+                keys = static_cast<ArtNode4*>(node)->keys_;
+                children = static_cast<ArtNode4*>(node)->children_;
+            } else {
+                keys = static_cast<ArtNode16*>(node)->keys_;
+                children = static_cast<ArtNode16*>(node)->children_;
+            }
+            int i = 0;
+            while (keys[i] != byte) ++i;
+            for (; i + 1 < node->count_; ++i) {
+                keys[i] = keys[i + 1];
+                children[i] = children[i + 1];
+            }
+            node->count_--;
+            if (node->type_ == kArtNode16 && node->count_ <= 3) {
+                ArtNode16* n = static_cast<ArtNode16*>(node);
+                ArtNode4* shrunk = new ArtNode4();
+                ArtMoveHeader(n, shrunk);
+                for (int j = 0; j < n->count_; ++j) {
+                    shrunk->keys_[j] = n->keys_[j];
+                    shrunk->children_[j] = n->children_[j];
+                }
+                *ref = shrunk;
+                delete n;
+            }
+            return;
+        }
+        case kArtNode48: {
+            ArtNode48* n = static_cast<ArtNode48*>(node);
+            n->children_[n->index_[byte] - 1] = nullptr;
+            n->index_[byte] = 0;
+            n->count_--;
+            if (n->count_ <= 12) {
+                ArtNode16* shrunk = new ArtNode16();
+                ArtMoveHeader(n, shrunk);
+                shrunk->count_ = 0;
+                for (int b = 0; b < 256; ++b) {
+                    if (n->index_[b]) ArtInsertSorted(shrunk, b, n->children_[n->index_[b] - 1]);
+                }
+                *ref = shrunk;
+                delete n;
+            }
+            return;
+        }
+        default: {
+            ArtNode256* n = static_cast<ArtNode256*>(node);
+            n->children_[byte] = nullptr;
+            n->count_--;
+            if (n->count_ <= 36) {
+                ArtNode48* shrunk = new ArtNode48();
+                ArtMoveHeader(n, shrunk);
+                int slot = 0;
+                for (int b = 0; b < 256; ++b) {
+                    if (n->children_[b]) {
+                        shrunk->children_[slot] = n->children_[b];
+                        shrunk->index_[b] = ++slot;
+                    }
+                }
+                *ref = shrunk;
+                delete n;
+            }
+            return;
+        }
+    }
+}
+
+// Path compression after an erase: drops empty nodes and merges a node that
+// has a single child and no own leaf into that child.
+inline void ArtCompact(ArtNode** ref) {
+    ArtInner* node = static_cast<ArtInner*>(*ref);
+    if (node->count_ == 0) {
+        *ref = node->leaf_;
+        ArtDeleteInner(node);
+    } else if (node->count_ == 1 && !node->leaf_) {
+        int byte = ArtNextByte(node, -1);
+        ArtNode* child = ArtChildAt(node, byte);
+        if (child->type_ != kArtLeaf) {
+            ArtInner* inner = static_cast<ArtInner*>(child);
+            inner->prefix_ = node->prefix_ + static_cast<char>(byte) + inner->prefix_;
+        }
+        *ref = child;
+        ArtDeleteInner(node);
+    }
+}
+
+template <typename K, typename T>
+typename art_map<K, T>::Iterator& art_map<K, T>::Iterator::operator=(const Iterator& other) {
+    if (this != &other) {
+        stack_ = vector<ArtFrame>(other.stack_);
+        leaf_ = other.leaf_;
+    }
+    return *this;
+}
+
+template <typename K, typename T>
+void art_map<K, T>::Iterator::DescendMin(ArtNode* node) {
+    while (node->type_ != kArtLeaf) {
+        ArtInner* inner = static_cast<ArtInner*>(node);
+        if (inner->leaf_) {
+            stack_.push_back(ArtFrame(inner, -1));
+            leaf_ = static_cast<ArtLeaf<K, T>*>(inner->leaf_);
+            return;
+        }
+        int byte = ArtNextByte(inner, -1);
+        stack_.push_back(ArtFrame(inner, byte));
+        node = ArtChildAt(inner, byte);
+    }
+    leaf_ = static_cast<ArtLeaf<K, T>*>(node);
+}
+
+template <typename K, typename T>
+void art_map<K, T>::Iterator::operator++() {
+    while (stack_.size()) {
+        ArtFrame& frame = stack_.data()[stack_.size() - 1];
+        int byte = ArtNextByte(frame.node_, frame.byte_);
+        if (byte < 0) {
+            stack_.pop_back();
+            continue;
+        }
+        frame.byte_ = byte;
+        DescendMin(ArtChildAt(frame.node_, byte));
+        return;
+    }
+    leaf_ = nullptr;
+}
+
+template <typename K, typename T>
+typename art_map<K, T>::reference art_map<K, T>::Iterator::operator*() const {
+    if (!leaf_) {
+        throw std::out_of_range("ERROR: iterator is out of range");
+    }
+    return leaf_->data_;
+}
+
+template <typename K, typename T>
+art_map<K, T>::art_map(std::initializer_list<value_type> const& items) : art_map() {
+    for (auto& value : items) insert(value);
+}
+
+template <typename K, typename T>
+art_map<K, T>::art_map(const art_map& other) : art_map() {
+    for (auto it = other.begin(); it != other.end(); ++it) insert(it->first, it->second);
+}
+
+template <typename K, typename T>
+art_map<K, T>::art_map(art_map&& other) : art_map() {
+    swap(other);
+}
+
+template <typename K, typename T>
+art_map<K, T>& art_map<K, T>::operator=(art_map&& other) {
+    if (this != &other) {
+        clear();
+        swap(other);
+    }
+    return *this;
+}
+
+template <typename K, typename T>
+void art_map<K, T>::swap(art_map& other) {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+}
+
+template <typename K, typename T>
+void art_map<K, T>::FreeNode(ArtNode* node) {
+    if (node->type_ == kArtLeaf) {
+        delete static_cast<ArtLeaf<K, T>*>(node);
+        return;
+    }
+    ArtInner* inner = static_cast<ArtInner*>(node);
+    if (inner->leaf_) {
+        FreeNode(inner->leaf_);
+    }
+    for (int b = ArtNextByte(inner, -1); b >= 0; b = ArtNextByte(inner, b)) {
+        FreeNode(ArtChildAt(inner, b));
+    }
+    ArtDeleteInner(inner);
+}
+
+template <typename K, typename T>
+void art_map<K, T>::clear() {
+    if (root_) {
+        FreeNode(root_);
+    }
+    root_ = nullptr;
+    size_ = 0;
+}
+
+template <typename K, typename T>
+typename art_map<K, T>::iterator art_map<K, T>::begin() const {
+    iterator it;
+    if (root_) {
+        it.DescendMin(root_);
+    }
+    return it;
+}
+
+template <typename K, typename T>
+std::pair<ArtLeaf<K, T>*, bool> art_map<K, T>::InsertRec(ArtNode** ref, const std::string& bytes, size_t depth,
+                                                         const K& key) {
+    ArtNode* node = *ref;
+    if (node == nullptr) {
+        ArtLeaf<K, T>* leaf = new ArtLeaf<K, T>(key);
+        *ref = leaf;
+        return std::make_pair(leaf, true);
+    }
+    if (node->type_ == kArtLeaf) {
+        ArtLeaf<K, T>* old_leaf = static_cast<ArtLeaf<K, T>*>(node);
+        if (old_leaf->data_.first == key) {
+            return std::make_pair(old_leaf, false);
+        }
+        std::string old_bytes = ArtEncodeKey(old_leaf->data_.first);
+        size_t i = depth;
+        while (i < bytes.size() && i < old_bytes.size() && bytes[i] == old_bytes[i]) ++i;
+        ArtNode4* inner = new ArtNode4();
+        inner->prefix_ = bytes.substr(depth, i - depth);
+        ArtLeaf<K, T>* leaf = new ArtLeaf<K, T>(key);
+        if (old_bytes.size() == i) {
+            inner->leaf_ = old_leaf;
+        } else {
+            ArtInsertSorted(inner, old_bytes[i], old_leaf);
+        }
+        if (bytes.size() == i) {
+            inner->leaf_ = leaf;
+        } else {
+            ArtInsertSorted(inner, bytes[i], leaf);
+        }
+        *ref = inner;
+        return std::make_pair(leaf, true);
+    }
+    ArtInner* inner = static_cast<ArtInner*>(node);
+    size_t plen = inner->prefix_.size();
+    size_t p = 0;
+    while (p < plen && depth + p < bytes.size() && inner->prefix_[p] == bytes[depth + p]) ++p;
+    if (p < plen) {
+        ArtNode4* parent = new ArtNode4();
+        parent->prefix_ = inner->prefix_.substr(0, p);
+        uint8_t old_byte = inner->prefix_[p];
+        inner->prefix_.erase(0, p + 1);
+        ArtInsertSorted(parent, old_byte, inner);
+        ArtLeaf<K, T>* leaf = new ArtLeaf<K, T>(key);
+        if (depth + p == bytes.size()) {
+            parent->leaf_ = leaf;
+        } else {
+            ArtInsertSorted(parent, bytes[depth + p], leaf);
+        }
+        *ref = parent;
+        return std::make_pair(leaf, true);
+    }
+    depth += plen;
+    if (depth == bytes.size()) {
+        if (inner->leaf_) {
+            return std::make_pair(static_cast<ArtLeaf<K, T>*>(inner->leaf_), false);
+        }
+        ArtLeaf<K, T>* leaf = new ArtLeaf<K, T>(key);
+        inner->leaf_ = leaf;
+        return std::make_pair(leaf, true);
+    }
+    ArtNode** child = ArtFindChild(inner, bytes[depth]);
+    if (child) {
+        return InsertRec(child, bytes, depth + 1, key);
+    }
+    ArtLeaf<K, T>* leaf = new ArtLeaf<K, T>(key);
+    ArtAddChild(ref, bytes[depth], leaf);
+    return std::make_pair(leaf, true);
+}
+
+template <typename K, typename T>
+bool art_map<K, T>::EraseRec(ArtNode** ref, const std::string& bytes, size_t depth) {
+    ArtNode* node = *ref;
+    if (node == nullptr) {
+        return false;
+    }
+    if (node->type_ == kArtLeaf) {
+        if (ArtEncodeKey(static_cast<ArtLeaf<K, T>*>(node)->data_.first) != bytes) {
+            return false;
+        }
+        FreeNode(node);
+        *ref = nullptr;
+        return true;
+    }
+    ArtInner* inner = static_cast<ArtInner*>(node);
+    if (bytes.compare(depth, inner->prefix_.size(), inner->prefix_) != 0) {
+        return false;
+    }
+    depth += inner->prefix_.size();
+    if (depth == bytes.size()) {
+        if (!inner->leaf_) {
+            return false;
+        }
+        FreeNode(inner->leaf_);
+        inner->leaf_ = nullptr;
+    } else {
+        uint8_t byte = bytes[depth];
+        ArtNode** child = ArtFindChild(inner, byte);
+        if (!child || !EraseRec(child, bytes, depth + 1)) {
+            return false;
+        }
+        if (*child == nullptr) {
+            ArtRemoveChild(ref, byte);
+        }
+    }
+    ArtCompact(ref);
+    return true;
+}
+
+template <typename K, typename T>
+ArtLeaf<K, T>* art_map<K, T>::FindLeaf(const K& key) const {
+    const std::string bytes = ArtEncodeKey(key);
+    ArtNode* node = root_;
+    size_t depth = 0;
+    while (node) {
+        if (node->type_ == kArtLeaf) {
+            ArtLeaf<K, T>* leaf = static_cast<ArtLeaf<K, T>*>(node);
+            return leaf->data_.first == key ? leaf : nullptr;
+        }
+        ArtInner* inner = static_cast<ArtInner*>(node);
+        if (bytes.compare(depth, inner->prefix_.size(), inner->prefix_) != 0) {
+            return nullptr;
+        }
+        depth += inner->prefix_.size();
+        if (depth == bytes.size()) {
+            return static_cast<ArtLeaf<K, T>*>(inner->leaf_);
+        }
+        node = ArtChildAt(inner, bytes[depth]);
+        depth++;
+    }
+    return nullptr;
+}
+
+template <typename K, typename T>
+typename art_map<K, T>::iterator art_map<K, T>::LowerBoundBytes(const std::string& bytes) const {
+    iterator it;
+    ArtNode* node = root_;
+    size_t depth = 0;
+    while (node) {
+        if (node->type_ == kArtLeaf) {
+            it.leaf_ = static_cast<ArtLeaf<K, T>*>(node);
+            if (ArtEncodeKey(it.leaf_->data_.first).compare(bytes) < 0) {
+                ++it;
+            }
+            return it;
+        }
+        ArtInner* inner = static_cast<ArtInner*>(node);
+        const std::string& prefix = inner->prefix_;
+        size_t p = 0;
+        while (p < prefix.size() && depth + p < bytes.size() && prefix[p] == bytes[depth + p]) ++p;
+        if (p < prefix.size()) {
+            // the whole subtree is either above or below the searched key
+            if (depth + p == bytes.size() ||
+                static_cast<uint8_t>(prefix[p]) > static_cast<uint8_t>(bytes[depth + p])) {
+                it.DescendMin(node);
+            } else {
+                ++it;
+            }
+            return it;
+        }
+        depth += prefix.size();
+        if (depth == bytes.size()) {
+            it.DescendMin(node);
+            return it;
+        }
+        uint8_t byte = bytes[depth];
+        it.stack_.push_back(ArtFrame(inner, byte));
+        node = ArtChildAt(inner, byte);
+        depth++;
+    }
+    ++it;
+    return it;
+}
+
+template <typename K, typename T>
+std::pair<typename art_map<K, T>::iterator, bool> art_map<K, T>::insert(const K& key, const T& obj) {
+    if (size_ == max_size()) {
+        throw std::overflow_error("ERROR: Container is overflow!");
+    }
+    const std::string bytes = ArtEncodeKey(key);
+    auto result = InsertRec(&root_, bytes, 0, key);
+    if (result.second) {
+        result.first->data_.second = obj;
+        size_++;
+    }
+    return std::make_pair(LowerBoundBytes(bytes), result.second);
+}
+
+template <typename K, typename T>
+std::pair<typename art_map<K, T>::iterator, bool> art_map<K, T>::insert_or_assign(const K& key, const T& obj) {
+    const std::string bytes = ArtEncodeKey(key);
+    auto result = InsertRec(&root_, bytes, 0, key);
+    result.first->data_.second = obj;
+    if (result.second) {
+        size_++;
+    }
+    return std::make_pair(LowerBoundBytes(bytes), result.second);
+}
+
+template <typename K, typename T>
+typename art_map<K, T>::size_type art_map<K, T>::erase(const K& key) {
+    if (!EraseRec(&root_, ArtEncodeKey(key), 0)) {
+        return 0;
+    }
+    size_--;
+    return 1;
+}
+
+template <typename K, typename T>
+T& art_map<K, T>::operator[](const K& key) {
+    auto result = InsertRec(&root_, ArtEncodeKey(key), 0, key);
+    if (result.second) {
+        size_++;
+    }
+    return result.first->data_.second;
+}
+
+template <typename K, typename T>
+T& art_map<K, T>::at(const K& key) {
+    ArtLeaf<K, T>* leaf = FindLeaf(key);
+    if (!leaf) {
+        throw std::out_of_range("ERROR: key is out of range");
+    }
+    return leaf->data_.second;
+}
+
+template <typename K, typename T>
+typename art_map<K, T>::iterator art_map<K, T>::find(const K& key) const {
+    iterator it = lower_bound(key);
+    if (it.leaf_ && !(it.leaf_->data_.first == key)) {
+        return end();
+    }
+    return it;
+}
+
+template <typename K, typename T>
+std::pair<typename art_map<K, T>::iterator, typename art_map<K, T>::iterator> art_map<K, T>::prefix_range(
+    const std::string& prefix) const {
+    std::string upper = prefix;
+    while (!upper.empty() && static_cast<uint8_t>(upper.back()) == 0xFF) {
+        upper.pop_back();
+    }
+    if (upper.empty()) {
+        return std::make_pair(LowerBoundBytes(prefix), end());
+    }
+    upper.back() = static_cast<char>(static_cast<uint8_t>(upper.back()) + 1);
+    return std::make_pair(LowerBoundBytes(prefix), LowerBoundBytes(upper));
+}
+}  // namespace sfleta_
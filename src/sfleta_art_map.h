@@ -0,0 +1,153 @@
+#ifndef SRC_sfleta_ART_MAP_H_
+#define SRC_sfleta_ART_MAP_H_
+#include <stdint.h>
+
+#include <initializer_list>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "sfleta_vector.h"
+namespace sfleta_ {
+enum art_node_types { kArtLeaf, kArtNode4, kArtNode16, kArtNode48, kArtNode256 };
+
+class ArtNode {
+ public:
+    art_node_types type_;
+    explicit ArtNode(art_node_types type) : type_(type) {}
+};
+
+// Inner node header: prefix_ holds the compressed path below the parent's key
+// byte, leaf_ the entry whose key ends exactly after prefix_ (string keys).
+class ArtInner : public ArtNode {
+ public:
+    uint16_t count_;
+    std::string prefix_;
+    ArtNode* leaf_;
+    explicit ArtInner(art_node_types type) : ArtNode(type), count_(0), leaf_(nullptr) {}
+};
+
+class ArtNode4 : public ArtInner {
+ public:
+    uint8_t keys_[4];
+    ArtNode* children_[4];
+    ArtNode4() : ArtInner(kArtNode4), keys_(), children_() {}
+};
+
+class ArtNode16 : public ArtInner {
+ public:
+    uint8_t keys_[16];
+    ArtNode* children_[16];
+    ArtNode16() : ArtInner(kArtNode16), keys_(), children_() {}
+};
+
+class ArtNode48 : public ArtInner {
+ public:
+    uint8_t index_[256];  // slot + 1, 0 when the byte has no child
+    ArtNode* children_[48];
+    ArtNode48() : ArtInner(kArtNode48), index_(), children_() {}
+};
+
+class ArtNode256 : public ArtInner {
+ public:
+    ArtNode* children_[256];
+    ArtNode256() : ArtInner(kArtNode256), children_() {}
+};
+
+template <typename K, typename T>
+class ArtLeaf : public ArtNode {
+ public:
+    std::pair<K, T> data_;
+    explicit ArtLeaf(const K& key) : ArtNode(kArtLeaf), data_(key, T()) {}
+};
+
+class ArtFrame {
+ public:
+    ArtInner* node_;
+    int byte_;  // last visited key byte, -1 while on the node's own leaf_
+    ArtFrame() : node_(nullptr), byte_(-1) {}
+    ArtFrame(ArtInner* node, int byte) : node_(node), byte_(byte) {}
+};
+
+// Binary-comparable encoding: big-endian integers with the sign bit flipped,
+// strings as is, so byte order equals key order.
+template <typename K>
+typename std::enable_if<std::is_integral<K>::value, std::string>::type ArtEncodeKey(const K& key);
+inline std::string ArtEncodeKey(const std::string& key) { return key; }
+
+template <typename K, typename T>
+class art_map {
+ public:
+    using key_type = K;
+    using mapped_type = T;
+    using value_type = std::pair<K, T>;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using size_type = size_t;
+
+    class Iterator {
+     public:
+        vector<ArtFrame> stack_;
+        ArtLeaf<K, T>* leaf_;
+        Iterator() : leaf_(nullptr) {}
+        Iterator(const Iterator& other) : stack_(other.stack_), leaf_(other.leaf_) {}
+        Iterator(Iterator&& other) = default;
+        Iterator& operator=(const Iterator& other);
+        Iterator& operator=(Iterator&& other) = default;
+        void operator++();
+        bool operator==(const Iterator& other) const { return leaf_ == other.leaf_; }
+        bool operator!=(const Iterator& other) const { return leaf_ != other.leaf_; }
+        reference operator*() const;
+        value_type* operator->() const { return &**this; }
+        void DescendMin(ArtNode* node);
+    };
+    using iterator = Iterator;
+
+ private:
+    ArtNode* root_;
+    size_type size_;
+
+    std::pair<ArtLeaf<K, T>*, bool> InsertRec(ArtNode** ref, const std::string& bytes, size_t depth, const K& key);
+    bool EraseRec(ArtNode** ref, const std::string& bytes, size_t depth);
+    ArtLeaf<K, T>* FindLeaf(const K& key) const;
+    void FreeNode(ArtNode* node);
+    iterator LowerBoundBytes(const std::string& bytes) const;
+
+ public:
+    art_map() : root_(nullptr), size_(0) {}
+    explicit art_map(std::initializer_list<value_type> const& items);
+    art_map(const art_map& other);
+    art_map(art_map&& other);
+    ~art_map() { clear(); }
+    art_map& operator=(art_map&& other);
+
+    iterator begin() const;
+    iterator end() const { return iterator(); }
+
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+    size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(ArtLeaf<K, T>) / 2; }
+
+    void clear();
+    std::pair<iterator, bool> insert(const_reference value) { return insert(value.first, value.second); }
+    std::pair<iterator, bool> insert(const K& key, const T& obj);
+    std::pair<iterator, bool> insert_or_assign(const K& key, const T& obj);
+    size_type erase(const K& key);
+    void erase(iterator pos) { erase(pos->first); }
+    void swap(art_map& other);
+
+    T& operator[](const K& key);
+    T& at(const K& key);
+    iterator find(const K& key) const;
+    bool contains(const K& key) const { return FindLeaf(key) != nullptr; }
+    iterator lower_bound(const K& key) const { return LowerBoundBytes(ArtEncodeKey(key)); }
+    // [first, last) of all keys whose encoded bytes start with prefix
+    std::pair<iterator, iterator> prefix_range(const std::string& prefix) const;
+};
+}  // namespace sfleta_
+#include "sfleta_art_map.cpp"
+#endif  // SRC_sfleta_ART_MAP_H_
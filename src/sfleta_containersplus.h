@@ -3,5 +3,20 @@
 
 #include "sfleta_array.h"
 #include "sfleta_multiset.h"
+#include "sfleta_counted_multiset.h"
+#include "sfleta_set_algebra.h"
+#include "sfleta_int_set.h"
+#include "sfleta_art_map.h"
+#include "sfleta_interval_map.h"
+#include "sfleta_small_vector.h"
+#include "sfleta_static_vector.h"
+#include "sfleta_simd.h"
+#include "sfleta_mmap_vector.h"
+#include "sfleta_huge_pages.h"
+#include "sfleta_parallel.h"
+#include "sfleta_radix_sort.h"
+#include "sfleta_soa_vector.h"
+#include "sfleta_deque.h"
+#include "sfleta_dynamic_bitset.h"
 
 #endif  // SRC_sfleta_CONTAINERSPLUS_H_
@@ -0,0 +1,146 @@
+namespace sfleta_ {
+template <typename K>
+void counted_multiset<K>::Iterator::operator++() {
+    if (++index_ >= multiplicity()) {
+        ++pos_;
+        index_ = 0;
+    }
+}
+
+template <typename K>
+void counted_multiset<K>::Iterator::operator--() {
+    if (index_ == 0) {
+        --pos_;
+        index_ = multiplicity() - 1;
+    } else {
+        --index_;
+    }
+}
+
+template <typename K>
+counted_multiset<K>::counted_multiset(std::initializer_list<value_type> const& items) : counted_multiset() {
+    for (auto& value : items) insert(value);
+}
+
+template <typename K>
+counted_multiset<K>::counted_multiset(const counted_multiset& other) : counted_multiset() {
+    vector<K> keys;
+    keys.reserve(other.distinct_size());
+    for (auto it = other.Tree<K, size_t>::begin(); it != other.Tree<K, size_t>::end(); ++it) {
+        keys.push_back(*it);
+    }
+    this->assign_sorted(keys.data(), keys.size());
+    auto src = other.Tree<K, size_t>::begin();
+    for (auto it = Tree<K, size_t>::begin(); it != Tree<K, size_t>::end(); ++it, ++src) {
+        it.node_->data_->second = src.node_->data_->second;
+    }
+    total_ = other.total_;
+}
+
+template <typename K>
+counted_multiset<K>::counted_multiset(counted_multiset&& other) : counted_multiset() {
+    *this = std::move(other);
+}
+
+template <typename K>
+counted_multiset<K>& counted_multiset<K>::operator=(counted_multiset&& other) {
+    if (this != &other) {
+        Tree<K, size_t>::operator=(std::move(other));
+        total_ = other.total_;
+        other.total_ = 0;
+    }
+    return *this;
+}
+
+template <typename K>
+void counted_multiset<K>::clear() {
+    Tree<K, size_t>::clear();
+    total_ = 0;
+}
+
+template <typename K>
+typename counted_multiset<K>::iterator counted_multiset<K>::insert(const value_type& value, size_type n) {
+    auto found = this->FindContains(value);
+    if (n == 0) {
+        return found.second ? iterator(found.first, 0) : end();
+    }
+    if (found.second) {
+        found.first.node_->data_->second += n;
+    } else {
+        found.first = Tree<K, size_t>::insert(value);
+        found.first.node_->data_->second = n;
+    }
+    total_ += n;
+    return iterator(found.first, found.first.node_->data_->second - 1);
+}
+
+template <typename K>
+void counted_multiset<K>::erase(iterator pos) {
+    if (pos.pos_.node_ == nullptr || pos == end()) {
+        return;
+    }
+    total_--;
+    if (--pos.pos_.node_->data_->second == 0) {
+        Tree<K, size_t>::erase(pos.pos_);
+    }
+}
+
+template <typename K>
+typename counted_multiset<K>::size_type counted_multiset<K>::erase(const_reference key) {
+    auto found = this->FindContains(key);
+    if (!found.second) {
+        return 0;
+    }
+    size_type removed = found.first.node_->data_->second;
+    total_ -= removed;
+    Tree<K, size_t>::erase(found.first);
+    return removed;
+}
+
+template <typename K>
+void counted_multiset<K>::swap(counted_multiset& other) {
+    std::swap(this->root_, other.root_);
+    std::swap(this->nil_, other.nil_);
+    std::swap(this->size_, other.size_);
+    std::swap(total_, other.total_);
+}
+
+template <typename K>
+void counted_multiset<K>::merge(counted_multiset& other) {
+    if (this == &other) {
+        return;
+    }
+    for (auto it = other.Tree<K, size_t>::begin(); it != other.Tree<K, size_t>::end(); ++it) {
+        insert(*it, it.node_->data_->second);
+    }
+    other.clear();
+}
+
+template <typename K>
+typename counted_multiset<K>::size_type counted_multiset<K>::count(const_reference key) {
+    auto found = this->FindContains(key);
+    return found.second ? found.first.node_->data_->second : 0;
+}
+
+template <typename K>
+typename counted_multiset<K>::iterator counted_multiset<K>::find(const_reference key) {
+    auto found = this->FindContains(key);
+    return found.second ? iterator(found.first, 0) : end();
+}
+
+template <typename K>
+typename counted_multiset<K>::iterator counted_multiset<K>::upper_bound(const_reference key) {
+    auto found = this->FindContains(key);
+    if (!found.second) {
+        return lower_bound(key);
+    }
+    ++found.first;
+    return iterator(found.first, 0);
+}
+
+template <typename K>
+std::pair<typename counted_multiset<K>::iterator, typename counted_multiset<K>::iterator>
+counted_multiset<K>::equal_range(const_reference key) {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+}
+}  // namespace sfleta_
@@ -0,0 +1,70 @@
+#ifndef SRC_sfleta_COUNTED_MULTISET_H_
+#define SRC_sfleta_COUNTED_MULTISET_H_
+#include "tree.h"
+#include "sfleta_vector.h"
+namespace sfleta_ {
+// multiset that keeps one tree node per distinct key together with its
+// occurrence count, so insert, erase of one occurrence, count and
+// equal_range are O(log distinct keys) regardless of duplicates.
+template <typename K>
+class counted_multiset : protected Tree<K, size_t> {
+ public:
+    using key_type = K;
+    using value_type = K;
+    using reference = K&;
+    using const_reference = const K&;
+    using size_type = size_t;
+    using node_iterator = typename Tree<K, size_t>::Iterator;
+
+    class Iterator {
+     public:
+        node_iterator pos_;
+        size_type index_;  // occurrence of *pos_ the iterator points at
+        Iterator() : index_(0) {}
+        Iterator(node_iterator pos, size_type index) : pos_(pos), index_(index) {}
+        void operator++();
+        void operator--();
+        bool operator==(Iterator other) { return pos_ == other.pos_ && index_ == other.index_; }
+        bool operator!=(Iterator other) { return !(*this == other); }
+        const K operator*() { return *pos_; }
+        size_type multiplicity() const { return pos_.node_->data_->second; }
+    };
+    using iterator = Iterator;
+
+ private:
+    size_type total_;
+
+ public:
+    counted_multiset() : Tree<K, size_t>(), total_(0) {}
+    explicit counted_multiset(std::initializer_list<value_type> const& items);
+    counted_multiset(const counted_multiset& other);
+    counted_multiset(counted_multiset&& other);
+    ~counted_multiset() {}
+    counted_multiset& operator=(counted_multiset&& other);
+
+    iterator begin() const { return iterator(Tree<K, size_t>::begin(), 0); }
+    iterator end() const { return iterator(Tree<K, size_t>::end(), 0); }
+
+    bool empty() const { return total_ == 0; }
+    size_type size() const { return total_; }
+    size_type distinct_size() const { return this->size_; }
+    size_type max_size() { return Tree<K, size_t>::max_size(); }
+
+    void clear();
+    iterator insert(const value_type& value) { return insert(value, 1); }
+    iterator insert(const value_type& value, size_type n);
+    void erase(iterator pos);
+    size_type erase(const_reference key);
+    void swap(counted_multiset& other);
+    void merge(counted_multiset& other);
+
+    size_type count(const_reference key);
+    iterator find(const_reference key);
+    bool contains(const_reference key) { return this->FindContains(key).second; }
+    std::pair<iterator, iterator> equal_range(const_reference key);
+    iterator lower_bound(const_reference key) const { return iterator(this->LowerBound(key), 0); }
+    iterator upper_bound(const_reference key);
+};
+}  // namespace sfleta_
+#include "sfleta_counted_multiset.cpp"
+#endif  // SRC_sfleta_COUNTED_MULTISET_H_
@@ -0,0 +1,271 @@
+namespace sfleta_ {
+template <typename T>
+T* deque<T>::allocate_block() {
+    return static_cast<T*>(::operator new(kBlockSize * sizeof(T), std::align_val_t(alignof(T))));
+}
+
+template <typename T>
+void deque<T>::deallocate_block(T* block) noexcept {
+    if (block) ::operator delete(block, std::align_val_t(alignof(T)));
+}
+
+template <typename T>
+bool deque<T>::acquire_block(size_type b) {
+    if (map_[b]) {
+        return false;
+    }
+    if (spare_) {
+        map_[b] = spare_;
+        spare_ = nullptr;
+    } else {
+        map_[b] = allocate_block();
+    }
+    return true;
+}
+
+template <typename T>
+void deque<T>::release_block(size_type b) noexcept {
+    deallocate_block(spare_);
+    spare_ = map_[b];
+    map_[b] = nullptr;
+}
+
+template <typename T>
+typename deque<T>::size_type deque<T>::used_blocks() const noexcept {
+    return size_ ? (start_ + size_ - 1) / kBlockSize - start_ / kBlockSize + 1 : 0;
+}
+
+template <typename T>
+void deque<T>::remap(size_type capacity) {
+    size_type used = used_blocks();
+    assert(capacity >= used + 2);
+    size_type first = start_ / kBlockSize;
+    size_type new_first = (capacity - used) / 2;
+    if (capacity == map_capacity_) {
+        // shift in place and clear the slots the blocks moved away from
+        if (new_first < first) {
+            std::copy(map_ + first, map_ + first + used, map_ + new_first);
+            std::fill(map_ + std::max(first, new_first + used), map_ + first + used, nullptr);
+        } else if (new_first > first) {
+            std::copy_backward(map_ + first, map_ + first + used, map_ + new_first + used);
+            std::fill(map_ + first, map_ + std::min(new_first, first + used), nullptr);
+        }
+    } else {
+        T** map = new T*[capacity]();
+        if (used) std::copy(map_ + first, map_ + first + used, map + new_first);
+        delete[] map_;
+        map_ = map;
+        map_capacity_ = capacity;
+    }
+    start_ = new_first * kBlockSize + start_ % kBlockSize;
+}
+
+template <typename T>
+void deque<T>::grow_map() {
+    size_type used = used_blocks();
+    // recentring in place is enough while the map is at most half full
+    remap(used + 2 <= map_capacity_ / 2 ? map_capacity_ : std::max<size_type>(8, 2 * (used + 2)));
+}
+
+template <typename T>
+void deque<T>::destroy_all() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (size_type i = 0; i < size_; ++i) std::destroy_at(slot(start_ + i));
+    }
+}
+
+template <typename T>
+deque<T>::deque(size_type n) : deque() {
+    resize(n);
+}
+
+template <typename T>
+deque<T>::deque(std::initializer_list<T> const& items) : deque() {
+    for (const T& item : items) emplace_back(item);
+}
+
+template <typename T>
+deque<T>::deque(const deque& other) : deque() {
+    for (const T& item : other) emplace_back(item);
+}
+
+template <typename T>
+deque<T>::deque(deque&& other) noexcept
+    : map_(other.map_), map_capacity_(other.map_capacity_), start_(other.start_), size_(other.size_),
+      spare_(other.spare_) {
+    other.map_ = nullptr;
+    other.map_capacity_ = 0;
+    other.start_ = 0;
+    other.size_ = 0;
+    other.spare_ = nullptr;
+}
+
+template <typename T>
+deque<T>& deque<T>::operator=(const deque& other) {
+    if (this != &other) {
+        deque copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+template <typename T>
+deque<T>& deque<T>::operator=(deque&& other) noexcept {
+    if (this != &other) {
+        deque moved(std::move(other));
+        swap(moved);
+    }
+    return *this;
+}
+
+template <typename T>
+deque<T>::~deque() {
+    clear();
+    deallocate_block(spare_);
+    delete[] map_;
+}
+
+template <typename T>
+void deque<T>::clear() noexcept {
+    if (size_ == 0) {
+        return;
+    }
+    destroy_all();
+    size_type first = start_ / kBlockSize;
+    size_type last = (start_ + size_ - 1) / kBlockSize;
+    for (size_type b = first; b <= last; ++b) release_block(b);
+    size_ = 0;
+}
+
+template <typename T>
+void deque<T>::resize(size_type n) {
+    while (size_ > n) pop_back();
+    while (size_ < n) emplace_back();
+}
+
+template <typename T>
+void deque<T>::shrink_to_fit() {
+    deallocate_block(spare_);
+    spare_ = nullptr;
+    if (size_ == 0) {
+        delete[] map_;
+        map_ = nullptr;
+        map_capacity_ = 0;
+        start_ = 0;
+    } else if (map_capacity_ > 2 * (used_blocks() + 2)) {
+        remap(used_blocks() + 2);
+    }
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::at(size_type pos) {
+    if (pos >= size_) {
+        throw std::out_of_range("error sfleta_deque: pos is out of bound");
+    }
+    return (*this)[pos];
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::at(size_type pos) const {
+    if (pos >= size_) {
+        throw std::out_of_range("error sfleta_deque: pos is out of bound");
+    }
+    return (*this)[pos];
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::front() {
+    if (size_ == 0) {
+        throw std::range_error("error sfleta_deque: front() of an empty deque");
+    }
+    return (*this)[0];
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::front() const {
+    if (size_ == 0) {
+        throw std::range_error("error sfleta_deque: front() of an empty deque");
+    }
+    return (*this)[0];
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::back() {
+    if (size_ == 0) {
+        throw std::range_error("error sfleta_deque: back() of an empty deque");
+    }
+    return (*this)[size_ - 1];
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::back() const {
+    if (size_ == 0) {
+        throw std::range_error("error sfleta_deque: back() of an empty deque");
+    }
+    return (*this)[size_ - 1];
+}
+
+template <typename T>
+template <typename... Args>
+typename deque<T>::reference deque<T>::emplace_back(Args&&... args) {
+    if ((start_ + size_) / kBlockSize >= map_capacity_) grow_map();
+    size_type pos = start_ + size_;
+    bool installed = acquire_block(pos / kBlockSize);
+    try {
+        ::new (static_cast<void*>(slot(pos))) T(std::forward<Args>(args)...);
+    } catch (...) {
+        if (installed) release_block(pos / kBlockSize);
+        throw;
+    }
+    ++size_;
+    return *slot(pos);
+}
+
+template <typename T>
+template <typename... Args>
+typename deque<T>::reference deque<T>::emplace_front(Args&&... args) {
+    if (start_ == 0) grow_map();
+    size_type pos = start_ - 1;
+    bool installed = acquire_block(pos / kBlockSize);
+    try {
+        ::new (static_cast<void*>(slot(pos))) T(std::forward<Args>(args)...);
+    } catch (...) {
+        if (installed) release_block(pos / kBlockSize);
+        throw;
+    }
+    start_ = pos;
+    ++size_;
+    return *slot(pos);
+}
+
+template <typename T>
+void deque<T>::pop_back() {
+    if (size_ == 0) {
+        throw std::range_error("error sfleta_deque: pop_back() on an empty deque");
+    }
+    size_type pos = start_ + size_ - 1;
+    std::destroy_at(slot(pos));
+    --size_;
+    if (size_ == 0 || pos % kBlockSize == 0) release_block(pos / kBlockSize);
+}
+
+template <typename T>
+void deque<T>::pop_front() {
+    if (size_ == 0) {
+        throw std::range_error("error sfleta_deque: pop_front() on an empty deque");
+    }
+    std::destroy_at(slot(start_));
+    ++start_;
+    --size_;
+    if (size_ == 0 || start_ % kBlockSize == 0) release_block((start_ - 1) / kBlockSize);
+}
+
+template <typename T>
+void deque<T>::swap(deque& other) noexcept {
+    std::swap(map_, other.map_);
+    std::swap(map_capacity_, other.map_capacity_);
+    std::swap(start_, other.start_);
+    std::swap(size_, other.size_);
+    std::swap(spare_, other.spare_);
+}
+}  // namespace sfleta_
@@ -0,0 +1,159 @@
+#ifndef SRC_sfleta_DEQUE_H_
+#define SRC_sfleta_DEQUE_H_
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+namespace sfleta_ {
+// Double-ended queue over fixed-size blocks of about 4 KB and a map of block
+// pointers. Elements are never relocated, so pushing and popping at either
+// end keeps references to the other elements valid. The block emptied last
+// is kept for the next push, so a deque used as a FIFO stops allocating.
+template <typename T>
+class deque {
+ public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using size_type = size_t;
+
+    template <bool Const>
+    class deque_iterator {
+        using owner = std::conditional_t<Const, const deque, deque>;
+
+     public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, const T&, T&>;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+
+        deque_iterator() : owner_(nullptr), pos_(0) {}
+        deque_iterator(owner* d, size_type pos) : owner_(d), pos_(pos) {}
+        // iterator converts to const_iterator
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        deque_iterator(const deque_iterator<false>& other) : owner_(other.owner_), pos_(other.pos_) {}
+
+        reference operator*() const { return (*owner_)[pos_]; }
+        pointer operator->() const { return &(*owner_)[pos_]; }
+        reference operator[](difference_type n) const { return (*owner_)[pos_ + n]; }
+        deque_iterator& operator++() { ++pos_; return *this; }
+        deque_iterator operator++(int) { deque_iterator tmp(*this); ++pos_; return tmp; }
+        deque_iterator& operator--() { --pos_; return *this; }
+        deque_iterator operator--(int) { deque_iterator tmp(*this); --pos_; return tmp; }
+        deque_iterator& operator+=(difference_type n) { pos_ += n; return *this; }
+        deque_iterator& operator-=(difference_type n) { pos_ -= n; return *this; }
+        deque_iterator operator+(difference_type n) const { return deque_iterator(owner_, pos_ + n); }
+        deque_iterator operator-(difference_type n) const { return deque_iterator(owner_, pos_ - n); }
+        difference_type operator-(const deque_iterator& other) const {
+            return static_cast<difference_type>(pos_) - static_cast<difference_type>(other.pos_);
+        }
+        bool operator==(const deque_iterator& other) const { return pos_ == other.pos_; }
+        bool operator!=(const deque_iterator& other) const { return pos_ != other.pos_; }
+        bool operator<(const deque_iterator& other) const { return pos_ < other.pos_; }
+        bool operator>(const deque_iterator& other) const { return pos_ > other.pos_; }
+        bool operator<=(const deque_iterator& other) const { return pos_ <= other.pos_; }
+        bool operator>=(const deque_iterator& other) const { return pos_ >= other.pos_; }
+        friend deque_iterator operator+(difference_type n, const deque_iterator& it) { return it + n; }
+
+     private:
+        friend class deque_iterator<true>;
+        owner* owner_;
+        size_type pos_;
+    };
+    using iterator = deque_iterator<false>;
+    using const_iterator = deque_iterator<true>;
+
+ private:
+    // largest power of two of at least 16 elements that fits in 4 KB
+    static constexpr size_type block_size() {
+        size_type n = 16;
+        while (n * 2 * sizeof(T) <= 4096) n *= 2;
+        return n;
+    }
+    static constexpr size_type kBlockSize = block_size();
+
+    // element i lives at map_[(start_ + i) / kBlockSize]; map slots outside
+    // the blocks holding elements are nullptr
+    T** map_;
+    size_type map_capacity_;
+    size_type start_;
+    size_type size_;
+    T* spare_;
+
+    static T* allocate_block();
+    static void deallocate_block(T* block) noexcept;
+    T* slot(size_type pos) const noexcept { return map_[pos / kBlockSize] + pos % kBlockSize; }
+    // makes sure map_[b] holds a block, true if it had to be installed
+    bool acquire_block(size_type b);
+    void release_block(size_type b) noexcept;
+    size_type used_blocks() const noexcept;
+    // moves the used blocks to the middle of a map of capacity slots, in place
+    // when the capacity stays the same
+    void remap(size_type capacity);
+    // makes room for one more block at both ends
+    void grow_map();
+    void destroy_all() noexcept;
+
+ public:
+    deque() noexcept : map_(nullptr), map_capacity_(0), start_(0), size_(0), spare_(nullptr) {}
+    explicit deque(size_type n);
+    deque(std::initializer_list<T> const& items);
+    deque(const deque& other);
+    deque(deque&& other) noexcept;
+    deque& operator=(const deque& other);
+    deque& operator=(deque&& other) noexcept;
+    ~deque();
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    size_type max_size() const noexcept { return std::numeric_limits<size_type>::max() / sizeof(T) / 2; }
+    void clear() noexcept;
+    void resize(size_type n);
+    // drops the cached block and shrinks the block map
+    void shrink_to_fit();
+
+    reference operator[](size_type pos) noexcept {
+        assert(pos < size_);
+        return *slot(start_ + pos);
+    }
+    const_reference operator[](size_type pos) const noexcept {
+        assert(pos < size_);
+        return *slot(start_ + pos);
+    }
+    reference at(size_type pos);
+    const_reference at(size_type pos) const;
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, size_); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, size_); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    void push_back(const_reference value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+    void push_front(const_reference value) { emplace_front(value); }
+    void push_front(value_type&& value) { emplace_front(std::move(value)); }
+    template <typename... Args>
+    reference emplace_back(Args&&... args);
+    template <typename... Args>
+    reference emplace_front(Args&&... args);
+    void pop_back();
+    void pop_front();
+    void swap(deque& other) noexcept;
+};
+}  // namespace sfleta_
+#include "sfleta_deque.cpp"
+#endif  // SRC_sfleta_DEQUE_H_
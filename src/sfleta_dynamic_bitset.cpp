@@ -0,0 +1,204 @@
+namespace sfleta_ {
+inline dynamic_bitset::dynamic_bitset(size_type n, bool value) : size_(n) {
+    words_.resize(words_for(n), value ? ~word_type(0) : word_type(0));
+    trim();
+}
+
+inline dynamic_bitset::dynamic_bitset(dynamic_bitset&& other) noexcept
+    : words_(std::move(other.words_)), size_(other.size_) {
+    other.size_ = 0;
+}
+
+inline dynamic_bitset& dynamic_bitset::operator=(const dynamic_bitset& other) {
+    if (this != &other) {
+        dynamic_bitset copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::operator=(dynamic_bitset&& other) noexcept {
+    if (this != &other) {
+        words_ = std::move(other.words_);
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+inline void dynamic_bitset::trim() noexcept {
+    if (size_ % kWordBits != 0) {
+        words_[words_.size() - 1] &= bit_mask(size_) - 1;
+    }
+}
+
+inline void dynamic_bitset::require_same_size(const dynamic_bitset& other) const {
+    if (size_ != other.size_) {
+        throw std::invalid_argument("error sfleta_dynamic_bitset: bitsets have different sizes");
+    }
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::scan_from(size_type w) const noexcept {
+    const word_type* p = words_.data();
+    for (size_type n = words_.size(); w < n; ++w) {
+        if (p[w] != 0) {
+            return w * kWordBits + __builtin_ctzll(p[w]);
+        }
+    }
+    return npos;
+}
+
+inline void dynamic_bitset::resize(size_type n, bool value) {
+    size_type old_size = size_;
+    words_.resize(words_for(n), value ? ~word_type(0) : word_type(0));
+    size_ = n;
+    // the tail of the old last word was kept zero and takes value as well
+    if (value && n > old_size && old_size % kWordBits != 0) {
+        words_[old_size / kWordBits] |= ~(bit_mask(old_size) - 1);
+    }
+    trim();
+}
+
+inline void dynamic_bitset::clear() noexcept {
+    words_.clear();
+    size_ = 0;
+}
+
+inline void dynamic_bitset::push_back(bool value) {
+    if (size_ % kWordBits == 0) {
+        words_.push_back(0);
+    }
+    if (value) {
+        words_[size_ / kWordBits] |= bit_mask(size_);
+    }
+    ++size_;
+}
+
+inline void dynamic_bitset::pop_back() {
+    if (size_ > 0) {
+        --size_;
+        if (size_ % kWordBits == 0) {
+            words_.pop_back();
+        } else {
+            trim();
+        }
+    }
+}
+
+inline bool dynamic_bitset::test(size_type pos) const {
+    if (pos >= size_) {
+        throw std::out_of_range("error sfleta_dynamic_bitset: pos is out of bound");
+    }
+    return (*this)[pos];
+}
+
+inline dynamic_bitset& dynamic_bitset::set(size_type pos, bool value) {
+    if (pos >= size_) {
+        throw std::out_of_range("error sfleta_dynamic_bitset: pos is out of bound");
+    }
+    (*this)[pos] = value;
+    return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::set() noexcept {
+    simd::fill(words_, ~word_type(0));
+    trim();
+    return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::reset(size_type pos) {
+    return set(pos, false);
+}
+
+inline dynamic_bitset& dynamic_bitset::reset() noexcept {
+    simd::fill(words_, word_type(0));
+    return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::flip(size_type pos) {
+    if (pos >= size_) {
+        throw std::out_of_range("error sfleta_dynamic_bitset: pos is out of bound");
+    }
+    (*this)[pos].flip();
+    return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::flip() noexcept {
+    word_type* p = words_.data();
+    for (size_type w = 0, n = words_.size(); w < n; ++w) p[w] = ~p[w];
+    trim();
+    return *this;
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::count() const noexcept {
+    return simd::popcount(words_);
+}
+
+inline bool dynamic_bitset::any() const noexcept {
+    return scan_from(0) != npos;
+}
+
+inline bool dynamic_bitset::all() const noexcept {
+    return count() == size_;
+}
+
+inline dynamic_bitset::size_type dynamic_bitset::find_next(size_type pos) const noexcept {
+    if (pos >= size_ || ++pos == size_) {
+        return npos;
+    }
+    size_type w = pos / kWordBits;
+    word_type rest = words_.data()[w] & ~(bit_mask(pos) - 1);
+    if (rest != 0) {
+        return w * kWordBits + __builtin_ctzll(rest);
+    }
+    return scan_from(w + 1);
+}
+
+inline dynamic_bitset& dynamic_bitset::operator&=(const dynamic_bitset& other) {
+    require_same_size(other);
+    simd::and_assign(words_, other.words_);
+    return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::operator|=(const dynamic_bitset& other) {
+    require_same_size(other);
+    simd::or_assign(words_, other.words_);
+    return *this;
+}
+
+inline dynamic_bitset& dynamic_bitset::operator^=(const dynamic_bitset& other) {
+    require_same_size(other);
+    simd::xor_assign(words_, other.words_);
+    return *this;
+}
+
+inline dynamic_bitset dynamic_bitset::operator~() const {
+    dynamic_bitset result(*this);
+    result.flip();
+    return result;
+}
+
+inline bool dynamic_bitset::operator==(const dynamic_bitset& other) const noexcept {
+    return size_ == other.size_ && simd::equal(words_, other.words_);
+}
+
+inline void dynamic_bitset::swap(dynamic_bitset& other) noexcept {
+    words_.swap(other.words_);
+    std::swap(size_, other.size_);
+}
+
+inline dynamic_bitset operator&(dynamic_bitset a, const dynamic_bitset& b) {
+    a &= b;
+    return a;
+}
+
+inline dynamic_bitset operator|(dynamic_bitset a, const dynamic_bitset& b) {
+    a |= b;
+    return a;
+}
+
+inline dynamic_bitset operator^(dynamic_bitset a, const dynamic_bitset& b) {
+    a ^= b;
+    return a;
+}
+}  // namespace sfleta_
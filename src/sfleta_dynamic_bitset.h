@@ -0,0 +1,118 @@
+#ifndef SRC_sfleta_DYNAMIC_BITSET_H_
+#define SRC_sfleta_DYNAMIC_BITSET_H_
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include "sfleta_simd.h"
+#include "sfleta_vector.h"
+namespace sfleta_ {
+// Resizable sequence of bits packed 64 to a word. Bits past size() in the
+// last word are always zero, so counting and comparing work on whole words
+// and the bulk operators run through the simd word kernels.
+class dynamic_bitset {
+ public:
+    using word_type = uint64_t;
+    using size_type = size_t;
+    static constexpr size_type kWordBits = 64;
+    static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+    // proxy for one bit, like std::vector<bool>::reference
+    class reference {
+     public:
+        reference(word_type* word, word_type mask) noexcept : word_(word), mask_(mask) {}
+        reference(const reference&) = default;
+        reference& operator=(bool value) noexcept {
+            if (value) {
+                *word_ |= mask_;
+            } else {
+                *word_ &= ~mask_;
+            }
+            return *this;
+        }
+        reference& operator=(const reference& other) noexcept { return *this = bool(other); }
+        operator bool() const noexcept { return (*word_ & mask_) != 0; }
+        bool operator~() const noexcept { return (*word_ & mask_) == 0; }
+        reference& flip() noexcept {
+            *word_ ^= mask_;
+            return *this;
+        }
+
+     private:
+        word_type* word_;
+        word_type mask_;
+    };
+
+ private:
+    vector<word_type> words_;
+    size_type size_;
+
+    static size_type words_for(size_type bits) { return bits / kWordBits + (bits % kWordBits != 0); }
+    static word_type bit_mask(size_type pos) { return word_type(1) << (pos % kWordBits); }
+    // clears the bits past size_ in the last word
+    void trim() noexcept;
+    void require_same_size(const dynamic_bitset& other) const;
+    // first set bit at or after word index w, npos if there is none
+    size_type scan_from(size_type w) const noexcept;
+
+ public:
+    dynamic_bitset() noexcept : size_(0) {}
+    explicit dynamic_bitset(size_type n, bool value = false);
+    dynamic_bitset(const dynamic_bitset& other) = default;
+    dynamic_bitset(dynamic_bitset&& other) noexcept;
+    dynamic_bitset& operator=(const dynamic_bitset& other);
+    dynamic_bitset& operator=(dynamic_bitset&& other) noexcept;
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    size_type num_words() const noexcept { return words_.size(); }
+    // packed words, bit i of the set is bit i % 64 of word i / 64
+    const word_type* data() const noexcept { return words_.data(); }
+    void reserve(size_type bits) { words_.reserve(words_for(bits)); }
+    void resize(size_type n, bool value = false);
+    void clear() noexcept;
+    void push_back(bool value);
+    void pop_back();
+
+    // unchecked, out of range access is only caught by assert in debug builds
+    reference operator[](size_type pos) noexcept {
+        assert(pos < size_);
+        return reference(words_.data() + pos / kWordBits, bit_mask(pos));
+    }
+    bool operator[](size_type pos) const noexcept {
+        assert(pos < size_);
+        return (words_.data()[pos / kWordBits] & bit_mask(pos)) != 0;
+    }
+    // checked, throws std::out_of_range
+    bool test(size_type pos) const;
+    dynamic_bitset& set(size_type pos, bool value = true);
+    dynamic_bitset& set() noexcept;
+    dynamic_bitset& reset(size_type pos);
+    dynamic_bitset& reset() noexcept;
+    dynamic_bitset& flip(size_type pos);
+    dynamic_bitset& flip() noexcept;
+
+    size_type count() const noexcept;
+    bool any() const noexcept;
+    bool none() const noexcept { return !any(); }
+    bool all() const noexcept;
+    // positions of set bits in increasing order, npos once there are no more
+    size_type find_first() const noexcept { return scan_from(0); }
+    size_type find_next(size_type pos) const noexcept;
+
+    // the binary operators throw std::invalid_argument if the sizes differ
+    dynamic_bitset& operator&=(const dynamic_bitset& other);
+    dynamic_bitset& operator|=(const dynamic_bitset& other);
+    dynamic_bitset& operator^=(const dynamic_bitset& other);
+    dynamic_bitset operator~() const;
+    bool operator==(const dynamic_bitset& other) const noexcept;
+    bool operator!=(const dynamic_bitset& other) const noexcept { return !(*this == other); }
+    void swap(dynamic_bitset& other) noexcept;
+};
+
+dynamic_bitset operator&(dynamic_bitset a, const dynamic_bitset& b);
+dynamic_bitset operator|(dynamic_bitset a, const dynamic_bitset& b);
+dynamic_bitset operator^(dynamic_bitset a, const dynamic_bitset& b);
+}  // namespace sfleta_
+#include "sfleta_dynamic_bitset.cpp"
+#endif  // SRC_sfleta_DYNAMIC_BITSET_H_
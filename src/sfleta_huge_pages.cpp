@@ -0,0 +1,35 @@
+namespace sfleta_ {
+inline size_t round_to_huge_page(size_t bytes) {
+    return (bytes + kHugePageSize - 1) & ~(kHugePageSize - 1);
+}
+
+template <size_t Threshold>
+void* huge_page_storage<Threshold>::allocate(size_t bytes, size_t align) {
+    if (bytes < Threshold) {
+        return ::operator new(bytes, std::align_val_t(align));
+    }
+    size_t length = round_to_huge_page(bytes);
+    // map one spare huge page and trim both ends to a 2 MB aligned window
+    void* raw = ::mmap(nullptr, length + kHugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) throw std::bad_alloc();
+    uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+    uintptr_t aligned = (start + kHugePageSize - 1) & ~(kHugePageSize - 1);
+    if (aligned > start) ::munmap(raw, aligned - start);
+    size_t tail = start + kHugePageSize - aligned;
+    if (tail) ::munmap(reinterpret_cast<void*>(aligned + length), tail);
+#ifdef MADV_HUGEPAGE
+    // failure only means the kernel keeps normal pages
+    ::madvise(reinterpret_cast<void*>(aligned), length, MADV_HUGEPAGE);
+#endif
+    return reinterpret_cast<void*>(aligned);
+}
+
+template <size_t Threshold>
+void huge_page_storage<Threshold>::deallocate(void* p, size_t bytes, size_t align) noexcept {
+    if (bytes < Threshold) {
+        ::operator delete(p, std::align_val_t(align));
+    } else {
+        ::munmap(p, round_to_huge_page(bytes));
+    }
+}
+}  // namespace sfleta_
@@ -0,0 +1,26 @@
+#ifndef SRC_sfleta_HUGE_PAGES_H_
+#define SRC_sfleta_HUGE_PAGES_H_
+#include <sys/mman.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include "sfleta_vector.h"
+namespace sfleta_ {
+constexpr size_t kHugePageSize = size_t(2) << 20;
+
+// vector storage policy: buffers of at least Threshold bytes are anonymous
+// mappings aligned to 2 MB and advised MADV_HUGEPAGE, so transparent huge pages
+// can back them and random access misses the TLB less often. Smaller buffers,
+// and systems without THP, get normal pages.
+template <size_t Threshold = kHugePageSize>
+struct huge_page_storage {
+    static void* allocate(size_t bytes, size_t align);
+    static void deallocate(void* p, size_t bytes, size_t align) noexcept;
+};
+
+template <typename T, typename Growth = growth_double>
+using huge_page_vector = vector<T, Growth, alignof(T), huge_page_storage<>>;
+}  // namespace sfleta_
+#include "sfleta_huge_pages.cpp"
+#endif  // SRC_sfleta_HUGE_PAGES_H_
@@ -0,0 +1,418 @@
+namespace sfleta_ {
+inline size_t BitmapCombine(const uint64_t* a, const uint64_t* b, uint64_t* out, size_t words, bitmap_ops op) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (const size_t simd_end = words & ~size_t(3); i < simd_end; i += 4) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        __m256i r;
+        switch (op) {
+            case kBitAnd: r = _mm256_and_si256(x, y); break;
+            case kBitOr: r = _mm256_or_si256(x, y); break;
+            case kBitAndNot: r = _mm256_andnot_si256(y, x); break;
+            default: r = _mm256_xor_si256(x, y); break;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), r);
+    }
+#elif defined(__SSE2__)
+    for (const size_t simd_end = words & ~size_t(1); i < simd_end; i += 2) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        __m128i r;
+        switch (op) {
+            case kBitAnd: r = _mm_and_si128(x, y); break;
+            case kBitOr: r = _mm_or_si128(x, y); break;
+            case kBitAndNot: r = _mm_andnot_si128(y, x); break;
+            default: r = _mm_xor_si128(x, y); break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), r);
+    }
+#endif
+    for (; i < words; ++i) {
+        switch (op) {
+            case kBitAnd: out[i] = a[i] & b[i]; break;
+            case kBitOr: out[i] = a[i] | b[i]; break;
+            case kBitAndNot: out[i] = a[i] & ~b[i]; break;
+            default: out[i] = a[i] ^ b[i]; break;
+        }
+    }
+    size_t count = 0;
+    for (i = 0; i < words; ++i) {
+        count += __builtin_popcountll(out[i]);
+    }
+    return count;
+}
+
+inline bool IntSetChunk::contains(uint16_t low) const {
+    if (is_bitmap()) {
+        return (bitmap_.data()[low >> 6] >> (low & 63)) & 1;
+    }
+    const uint16_t* first = array_.data();
+    const uint16_t* it = std::lower_bound(first, first + cardinality_, low);
+    return it != first + cardinality_ && *it == low;
+}
+
+inline bool IntSetChunk::insert(uint16_t low) {
+    if (!is_bitmap() && cardinality_ == kArrayLimit) {
+        ToBitmap();
+    }
+    if (is_bitmap()) {
+        uint64_t& word = bitmap_.data()[low >> 6];
+        uint64_t bit = uint64_t(1) << (low & 63);
+        if (word & bit) {
+            return false;
+        }
+        word |= bit;
+    } else {
+        uint16_t* first = array_.data();
+        uint16_t* it = std::lower_bound(first, first + cardinality_, low);
+        if (it != first + cardinality_ && *it == low) {
+            return false;
+        }
+        array_.insert(it, low);
+    }
+    cardinality_++;
+    return true;
+}
+
+inline bool IntSetChunk::erase(uint16_t low) {
+    if (is_bitmap()) {
+        uint64_t& word = bitmap_.data()[low >> 6];
+        uint64_t bit = uint64_t(1) << (low & 63);
+        if (!(word & bit)) {
+            return false;
+        }
+        word &= ~bit;
+        if (--cardinality_ <= kArrayLimit) {
+            ToArray();
+        }
+    } else {
+        uint16_t* first = array_.data();
+        uint16_t* it = std::lower_bound(first, first + cardinality_, low);
+        if (it == first + cardinality_ || *it != low) {
+            return false;
+        }
+        array_.erase(it);
+        cardinality_--;
+    }
+    return true;
+}
+
+inline size_t IntSetChunk::rank(uint16_t low) const {
+    if (!is_bitmap()) {
+        const uint16_t* first = array_.data();
+        return std::upper_bound(first, first + cardinality_, low) - first;
+    }
+    const uint64_t* words = bitmap_.data();
+    size_t count = 0;
+    for (size_t i = 0; i < size_t(low >> 6); ++i) {
+        count += __builtin_popcountll(words[i]);
+    }
+    return count + __builtin_popcountll(words[low >> 6] & (~uint64_t(0) >> (63 - (low & 63))));
+}
+
+inline uint32_t IntSetChunk::pos_of(uint16_t low) const {
+    if (is_bitmap()) {
+        return low;
+    }
+    const uint16_t* first = array_.data();
+    return std::lower_bound(first, first + cardinality_, low) - first;
+}
+
+inline void IntSetChunk::ToBitmap() {
+    vector<uint64_t> bits(kBitmapWords);
+    for (size_t i = 0; i < cardinality_; ++i) {
+        uint16_t low = array_.data()[i];
+        bits.data()[low >> 6] |= uint64_t(1) << (low & 63);
+    }
+    bitmap_ = std::move(bits);
+    array_ = vector<uint16_t>();
+}
+
+inline void IntSetChunk::ToArray() {
+    vector<uint16_t> values;
+    values.reserve(cardinality_);
+    for (uint32_t pos = NextSet(0); pos < kBlockSize; pos = NextSet(pos + 1)) {
+        values.push_back(static_cast<uint16_t>(pos));
+    }
+    array_ = std::move(values);
+    bitmap_ = vector<uint64_t>();
+}
+
+inline uint32_t IntSetChunk::NextSet(uint32_t from) const {
+    if (from >= kBlockSize) {
+        return kBlockSize;
+    }
+    const uint64_t* words = bitmap_.data();
+    size_t w = from >> 6;
+    uint64_t word = words[w] & (~uint64_t(0) << (from & 63));
+    while (!word) {
+        if (++w == kBitmapWords) {
+            return kBlockSize;
+        }
+        word = words[w];
+    }
+    return (w << 6) + __builtin_ctzll(word);
+}
+
+inline uint32_t IntSetChunk::PrevSet(uint32_t from) const {
+    const uint64_t* words = bitmap_.data();
+    size_t w = from >> 6;
+    uint64_t word = words[w] & (~uint64_t(0) >> (63 - (from & 63)));
+    while (!word) {
+        word = words[--w];
+    }
+    return (w << 6) + 63 - __builtin_clzll(word);
+}
+
+// Combines two chunks of the same block; returns nullptr for an empty result.
+inline IntSetChunk* CombineChunks(const IntSetChunk& a, const IntSetChunk& b, bitmap_ops op) {
+    IntSetChunk* out = new IntSetChunk();
+    if (!a.is_bitmap() && (op == kBitAnd || op == kBitAndNot || !b.is_bitmap())) {
+        const uint16_t* va = a.array_.data();
+        if (b.is_bitmap()) {
+            for (size_t i = 0; i < a.cardinality_; ++i) {
+                if (b.contains(va[i]) == (op == kBitAnd)) out->array_.push_back(va[i]);
+            }
+        } else {
+            const bool keep_a = op != kBitAnd, keep_b = op == kBitOr || op == kBitXor;
+            const bool keep_both = op == kBitAnd || op == kBitOr;
+            const uint16_t* vb = b.array_.data();
+            size_t i = 0, j = 0;
+            out->array_.reserve(a.cardinality_ + (keep_b ? b.cardinality_ : 0));
+            while (i < a.cardinality_ && j < b.cardinality_) {
+                if (va[i] < vb[j]) {
+                    if (keep_a) out->array_.push_back(va[i]);
+                    ++i;
+                } else if (vb[j] < va[i]) {
+                    if (keep_b) out->array_.push_back(vb[j]);
+                    ++j;
+                } else {
+                    if (keep_both) out->array_.push_back(va[i]);
+                    ++i;
+                    ++j;
+                }
+            }
+            for (; keep_a && i < a.cardinality_; ++i) out->array_.push_back(va[i]);
+            for (; keep_b && j < b.cardinality_; ++j) out->array_.push_back(vb[j]);
+        }
+        out->cardinality_ = out->array_.size();
+    } else if (!b.is_bitmap() && op == kBitAnd) {
+        const uint16_t* vb = b.array_.data();
+        for (size_t j = 0; j < b.cardinality_; ++j) {
+            if (a.contains(vb[j])) out->array_.push_back(vb[j]);
+        }
+        out->cardinality_ = out->array_.size();
+    } else {
+        IntSetChunk* tmp_a = a.is_bitmap() ? nullptr : new IntSetChunk(a);
+        IntSetChunk* tmp_b = b.is_bitmap() ? nullptr : new IntSetChunk(b);
+        if (tmp_a) tmp_a->ToBitmap();
+        if (tmp_b) tmp_b->ToBitmap();
+        const IntSetChunk* pa = tmp_a ? tmp_a : &a;
+        const IntSetChunk* pb = tmp_b ? tmp_b : &b;
+        out->bitmap_ = vector<uint64_t>(IntSetChunk::kBitmapWords);
+        out->cardinality_ = BitmapCombine(pa->bitmap_.data(), pb->bitmap_.data(), out->bitmap_.data(),
+                                          IntSetChunk::kBitmapWords, op);
+        delete tmp_a;
+        delete tmp_b;
+        if (out->cardinality_ != 0 && out->cardinality_ <= IntSetChunk::kArrayLimit) out->ToArray();
+    }
+    if (out->cardinality_ == 0) {
+        delete out;
+        return nullptr;
+    }
+    if (!out->is_bitmap() && out->cardinality_ > IntSetChunk::kArrayLimit) out->ToBitmap();
+    return out;
+}
+
+inline void int_set::Iterator::operator++() {
+    const IntSetChunk* chunk = owner_->chunks_.data()[chunk_];
+    pos_ = chunk->next_pos(pos_);
+    if (pos_ == chunk->end_pos()) {
+        ++chunk_;
+        pos_ = chunk_ < owner_->chunks_.size() ? owner_->chunks_.data()[chunk_]->begin_pos() : 0;
+    }
+}
+
+inline void int_set::Iterator::operator--() {
+    if (chunk_ == owner_->chunks_.size() || pos_ == owner_->chunks_.data()[chunk_]->begin_pos()) {
+        --chunk_;
+        const IntSetChunk* chunk = owner_->chunks_.data()[chunk_];
+        pos_ = chunk->prev_pos(chunk->end_pos());
+    } else {
+        pos_ = owner_->chunks_.data()[chunk_]->prev_pos(pos_);
+    }
+}
+
+inline int_set::value_type int_set::Iterator::operator*() const {
+    if (!owner_ || chunk_ >= owner_->chunks_.size()) {
+        throw std::out_of_range("ERROR: iterator is out of range");
+    }
+    return (value_type(owner_->keys_.data()[chunk_]) << 16) | owner_->chunks_.data()[chunk_]->value_at(pos_);
+}
+
+inline int_set::int_set(std::initializer_list<value_type> const& items) : int_set() {
+    for (auto& value : items) insert(value);
+}
+
+inline int_set::int_set(const int_set& s) : keys_(s.keys_), size_(s.size_) {
+    chunks_.reserve(s.chunks_.size());
+    for (size_t i = 0; i < s.chunks_.size(); ++i) {
+        chunks_.push_back(new IntSetChunk(*s.chunks_.data()[i]));
+    }
+}
+
+inline int_set::int_set(int_set&& s) : int_set() {
+    swap(s);
+}
+
+inline int_set& int_set::operator=(int_set&& s) {
+    if (this != &s) {
+        remove_chunks();
+        swap(s);
+    }
+    return *this;
+}
+
+inline void int_set::remove_chunks() {
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+        delete chunks_.data()[i];
+    }
+    chunks_.clear();
+    keys_.clear();
+    size_ = 0;
+}
+
+inline size_t int_set::FindChunk(uint16_t high) const {
+    const uint16_t* first = keys_.data();
+    return std::lower_bound(first, first + keys_.size(), high) - first;
+}
+
+inline int_set::iterator int_set::begin() const {
+    if (chunks_.size() == 0) {
+        return end();
+    }
+    return iterator(this, 0, chunks_.data()[0]->begin_pos());
+}
+
+inline int_set::size_type int_set::rank(value_type key) const {
+    uint16_t high = key >> 16;
+    size_t idx = FindChunk(high);
+    size_type result = 0;
+    for (size_t i = 0; i < idx; ++i) {
+        result += chunks_.data()[i]->cardinality_;
+    }
+    if (idx < keys_.size() && keys_.data()[idx] == high) {
+        result += chunks_.data()[idx]->rank(key & 0xFFFF);
+    }
+    return result;
+}
+
+inline std::pair<int_set::iterator, bool> int_set::insert(value_type value) {
+    uint16_t high = value >> 16;
+    uint16_t low = value & 0xFFFF;
+    size_t idx = FindChunk(high);
+    if (idx == keys_.size() || keys_.data()[idx] != high) {
+        keys_.insert(keys_.begin() + idx, high);
+        chunks_.insert(chunks_.begin() + idx, new IntSetChunk());
+    }
+    IntSetChunk* chunk = chunks_.data()[idx];
+    bool inserted = chunk->insert(low);
+    if (inserted) {
+        size_++;
+    }
+    return std::make_pair(iterator(this, idx, chunk->pos_of(low)), inserted);
+}
+
+inline int_set::size_type int_set::erase(value_type key) {
+    uint16_t high = key >> 16;
+    size_t idx = FindChunk(high);
+    if (idx == keys_.size() || keys_.data()[idx] != high) {
+        return 0;
+    }
+    IntSetChunk* chunk = chunks_.data()[idx];
+    if (!chunk->erase(key & 0xFFFF)) {
+        return 0;
+    }
+    size_--;
+    if (chunk->cardinality_ == 0) {
+        delete chunk;
+        keys_.erase(keys_.begin() + idx);
+        chunks_.erase(chunks_.begin() + idx);
+    }
+    return 1;
+}
+
+inline void int_set::swap(int_set& other) {
+    keys_.swap(other.keys_);
+    chunks_.swap(other.chunks_);
+    std::swap(size_, other.size_);
+}
+
+inline void int_set::merge(int_set& other) {
+    int_set duplicates = set_intersection(*this, other);
+    *this = set_union(*this, other);
+    other = std::move(duplicates);
+}
+
+inline int_set::iterator int_set::find(value_type key) const {
+    uint16_t high = key >> 16;
+    uint16_t low = key & 0xFFFF;
+    size_t idx = FindChunk(high);
+    if (idx == keys_.size() || keys_.data()[idx] != high || !chunks_.data()[idx]->contains(low)) {
+        return end();
+    }
+    return iterator(this, idx, chunks_.data()[idx]->pos_of(low));
+}
+
+inline bool int_set::contains(value_type key) const {
+    uint16_t high = key >> 16;
+    size_t idx = FindChunk(high);
+    return idx < keys_.size() && keys_.data()[idx] == high && chunks_.data()[idx]->contains(key & 0xFFFF);
+}
+
+inline int_set CombineSets(const int_set& a, const int_set& b, bitmap_ops op) {
+    int_set result;
+    const bool keep_a = op != kBitAnd, keep_b = op == kBitOr || op == kBitXor;
+    size_t i = 0, j = 0;
+    const size_t n = a.keys_.size(), m = b.keys_.size();
+    while (i < n || j < m) {
+        uint32_t ka = i < n ? a.keys_.data()[i] : IntSetChunk::kBlockSize;
+        uint32_t kb = j < m ? b.keys_.data()[j] : IntSetChunk::kBlockSize;
+        IntSetChunk* chunk = nullptr;
+        if (ka < kb) {
+            if (keep_a) chunk = new IntSetChunk(*a.chunks_.data()[i]);
+            ++i;
+        } else if (kb < ka) {
+            if (keep_b) chunk = new IntSetChunk(*b.chunks_.data()[j]);
+            ++j;
+        } else {
+            chunk = CombineChunks(*a.chunks_.data()[i], *b.chunks_.data()[j], op);
+            ++i;
+            ++j;
+        }
+        if (chunk) {
+            result.keys_.push_back(static_cast<uint16_t>(std::min(ka, kb)));
+            result.chunks_.push_back(chunk);
+            result.size_ += chunk->cardinality_;
+        }
+    }
+    return result;
+}
+
+inline int_set set_union(const int_set& a, const int_set& b) {
+    return CombineSets(a, b, kBitOr);
+}
+
+inline int_set set_intersection(const int_set& a, const int_set& b) {
+    return CombineSets(a, b, kBitAnd);
+}
+
+inline int_set set_difference(const int_set& a, const int_set& b) {
+    return CombineSets(a, b, kBitAndNot);
+}
+
+inline int_set set_symmetric_difference(const int_set& a, const int_set& b) {
+    return CombineSets(a, b, kBitXor);
+}
+}  // namespace sfleta_
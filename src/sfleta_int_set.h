@@ -0,0 +1,118 @@
+#ifndef SRC_sfleta_INT_SET_H_
+#define SRC_sfleta_INT_SET_H_
+#include <stdint.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "sfleta_vector.h"
+namespace sfleta_ {
+enum bitmap_ops { kBitAnd, kBitOr, kBitAndNot, kBitXor };
+
+// Values of one 64K block (same high 16 bits) of an int_set: a sorted array of
+// the low halves while the block is sparse, a 65536-bit bitmap once it is dense.
+class IntSetChunk {
+ public:
+    static constexpr size_t kArrayLimit = 4096;
+    static constexpr size_t kBitmapWords = 1024;
+    static constexpr uint32_t kBlockSize = 65536;
+
+    size_t cardinality_;
+    vector<uint16_t> array_;
+    vector<uint64_t> bitmap_;
+
+    IntSetChunk() : cardinality_(0) {}
+    bool is_bitmap() const { return bitmap_.size() != 0; }
+    bool contains(uint16_t low) const;
+    bool insert(uint16_t low);
+    bool erase(uint16_t low);
+    size_t rank(uint16_t low) const;
+
+    uint32_t begin_pos() const { return is_bitmap() ? NextSet(0) : 0; }
+    uint32_t end_pos() const { return is_bitmap() ? kBlockSize : cardinality_; }
+    uint32_t next_pos(uint32_t pos) const { return is_bitmap() ? NextSet(pos + 1) : pos + 1; }
+    uint32_t prev_pos(uint32_t pos) const { return is_bitmap() ? PrevSet(pos - 1) : pos - 1; }
+    uint32_t pos_of(uint16_t low) const;
+    uint16_t value_at(uint32_t pos) const { return is_bitmap() ? static_cast<uint16_t>(pos) : array_.data()[pos]; }
+
+    void ToBitmap();
+    void ToArray();
+
+ private:
+    uint32_t NextSet(uint32_t from) const;
+    uint32_t PrevSet(uint32_t from) const;
+};
+
+class int_set {
+ public:
+    using key_type = uint32_t;
+    using value_type = uint32_t;
+    using reference = uint32_t&;
+    using const_reference = const uint32_t&;
+    using size_type = size_t;
+
+    class Iterator {
+     public:
+        const int_set* owner_;
+        size_t chunk_;
+        uint32_t pos_;
+        Iterator() : owner_(nullptr), chunk_(0), pos_(0) {}
+        Iterator(const int_set* owner, size_t chunk, uint32_t pos) : owner_(owner), chunk_(chunk), pos_(pos) {}
+        void operator++();
+        void operator--();
+        bool operator==(const Iterator& other) const { return chunk_ == other.chunk_ && pos_ == other.pos_; }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+        value_type operator*() const;
+    };
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+
+ private:
+    vector<uint16_t> keys_;
+    vector<IntSetChunk*> chunks_;
+    size_type size_;
+
+    size_t FindChunk(uint16_t high) const;
+    void remove_chunks();
+
+ public:
+    int_set() : size_(0) {}
+    explicit int_set(std::initializer_list<value_type> const& items);
+    int_set(const int_set& s);
+    int_set(int_set&& s);
+    ~int_set() { remove_chunks(); }
+    int_set& operator=(int_set&& s);
+
+    iterator begin() const;
+    iterator end() const { return iterator(this, chunks_.size(), 0); }
+
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+    size_type max_size() const { return size_type(std::numeric_limits<uint32_t>::max()) + 1; }
+    size_type rank(value_type key) const;
+
+    void clear() { remove_chunks(); }
+    std::pair<iterator, bool> insert(value_type value);
+    void erase(iterator pos) { erase(*pos); }
+    size_type erase(value_type key);
+    void swap(int_set& other);
+    void merge(int_set& other);
+
+    iterator find(value_type key) const;
+    bool contains(value_type key) const;
+
+    friend int_set CombineSets(const int_set& a, const int_set& b, bitmap_ops op);
+};
+
+int_set set_union(const int_set& a, const int_set& b);
+int_set set_intersection(const int_set& a, const int_set& b);
+int_set set_difference(const int_set& a, const int_set& b);
+int_set set_symmetric_difference(const int_set& a, const int_set& b);
+}  // namespace sfleta_
+#include "sfleta_int_set.cpp"
+#endif  // SRC_sfleta_INT_SET_H_
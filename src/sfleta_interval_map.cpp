@@ -0,0 +1,68 @@
+namespace sfleta_ {
+template <typename Node>
+void interval_max_update::update(Node* node, const Node* nil) {
+    auto max_hi = node->data_->second.hi_;
+    if (node->p_left_ && node->p_left_ != nil && max_hi < node->p_left_->data_->second.max_hi_) {
+        max_hi = node->p_left_->data_->second.max_hi_;
+    }
+    if (node->p_right_ && node->p_right_ != nil && max_hi < node->p_right_->data_->second.max_hi_) {
+        max_hi = node->p_right_->data_->second.max_hi_;
+    }
+    node->data_->second.max_hi_ = max_hi;
+}
+
+template <typename K, typename T>
+interval_map<K, T>::interval_map(const interval_map& other) : interval_map() {
+    for (auto it = other.begin(); it != other.end(); ++it) {
+        insert(it.lo(), it.hi(), it.value());
+    }
+}
+
+template <typename K, typename T>
+interval_map<K, T>& interval_map<K, T>::operator=(interval_map&& other) {
+    tree_type::operator=(std::move(other));
+    return *this;
+}
+
+template <typename K, typename T>
+typename interval_map<K, T>::iterator interval_map<K, T>::insert(const K& lo, const K& hi, const T& value) {
+    if (hi < lo) {
+        throw std::invalid_argument("ERROR: interval end is less than its start");
+    }
+    node_type* node = tree_type::insert(lo).node_;
+    node->data_->second.hi_ = hi;
+    node->data_->second.value_ = value;
+    // the hook ran before hi_ was known, refresh the path it belongs to
+    this->UpdatePath(node);
+    return iterator(node);
+}
+
+template <typename K, typename T>
+template <typename F>
+void interval_map<K, T>::OverlapRec(node_type* node, const K& lo, const K& hi, F& f) const {
+    if (node == nullptr || node == this->nil_ || node->data_->second.max_hi_ < lo) {
+        return;
+    }
+    OverlapRec(node->p_left_, lo, hi, f);
+    if (hi < node->data_->first) {
+        return;
+    }
+    if (!(node->data_->second.hi_ < lo)) {
+        f(iterator(node));
+    }
+    OverlapRec(node->p_right_, lo, hi, f);
+}
+
+template <typename K, typename T>
+template <typename F>
+void interval_map<K, T>::for_each_overlap(const K& lo, const K& hi, F f) const {
+    OverlapRec(this->root_, lo, hi, f);
+}
+
+template <typename K, typename T>
+vector<typename interval_map<K, T>::iterator> interval_map<K, T>::overlapping(const K& lo, const K& hi) const {
+    vector<iterator> result;
+    for_each_overlap(lo, hi, [&result](iterator it) { result.push_back(it); });
+    return result;
+}
+}  // namespace sfleta_
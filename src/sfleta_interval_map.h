@@ -0,0 +1,75 @@
+#ifndef SRC_sfleta_INTERVAL_MAP_H_
+#define SRC_sfleta_INTERVAL_MAP_H_
+#include "tree.h"
+#include "sfleta_vector.h"
+namespace sfleta_ {
+template <typename K, typename T>
+class IntervalData {
+ public:
+    K hi_;
+    K max_hi_;  // largest hi_ in the subtree, kept by interval_max_update
+    T value_;
+    IntervalData() : hi_(), max_hi_(), value_() {}
+};
+
+// Tree node update policy of interval_map, recomputes IntervalData::max_hi_
+struct interval_max_update {
+    template <typename Node>
+    static void update(Node* node, const Node* nil);
+};
+
+// Closed intervals [lo, hi] keyed by lo (several intervals may share lo),
+// stored in the red-black Tree augmented with the subtree maximum of hi.
+template <typename K, typename T>
+class interval_map : protected Tree<K, IntervalData<K, T>, interval_max_update> {
+    using tree_type = Tree<K, IntervalData<K, T>, interval_max_update>;
+
+ public:
+    using key_type = K;
+    using mapped_type = T;
+    using size_type = size_t;
+    using node_type = TreeNode<K, IntervalData<K, T>>;
+
+    class Iterator : public tree_type::Iterator {
+     public:
+        Iterator() : tree_type::Iterator() {}
+        explicit Iterator(node_type* node) { this->node_ = node; }
+        K lo() const { return this->node_->data_->first; }
+        K hi() const { return this->node_->data_->second.hi_; }
+        T& value() const { return this->node_->data_->second.value_; }
+    };
+    using iterator = Iterator;
+
+ private:
+    template <typename F>
+    void OverlapRec(node_type* node, const K& lo, const K& hi, F& f) const;
+
+ public:
+    interval_map() : tree_type() {}
+    interval_map(const interval_map& other);
+    interval_map(interval_map&& other) : interval_map() { *this = std::move(other); }
+    interval_map& operator=(interval_map&& other);
+
+    iterator begin() const { return iterator(tree_type::begin().node_); }
+    iterator end() const { return iterator(tree_type::end().node_); }
+
+    bool empty() const { return this->size_ == 0; }
+    size_type size() const { return this->size_; }
+    void clear() { tree_type::clear(); }
+
+    iterator insert(const K& lo, const K& hi, const T& value);
+    void erase(iterator pos) { tree_type::erase(pos); }
+
+    // Calls f(iterator) for every interval intersecting [lo, hi], in order of lo.
+    // Subtrees whose max hi is below lo, or whose keys are past hi, are
+    // skipped, so reporting k intervals costs O(min(n, k log n)), not the
+    // O(log n + k) of a static centered interval tree: each reported
+    // interval may take its own walk down one branch of the tree.
+    template <typename F>
+    void for_each_overlap(const K& lo, const K& hi, F f) const;
+    vector<iterator> overlapping(const K& lo, const K& hi) const;
+    vector<iterator> stabbing(const K& point) const { return overlapping(point, point); }
+};
+}  // namespace sfleta_
+#include "sfleta_interval_map.cpp"
+#endif  // SRC_sfleta_INTERVAL_MAP_H_
@@ -50,8 +50,19 @@ typename list<T>::const_reference list<T>::const_iterator::operator*() {
 }
 
 template <typename T>
-list<T>::list() : LSQContainer<T>() {
-  p_after_tail_ = new Node<T>();
+list<T>::list() noexcept(std::is_nothrow_default_constructible<T>::value)
+    : LSQContainer<T>(), p_after_tail_(this) {}
+
+template <typename T>
+void list<T>::link_sentinel() noexcept {
+  if (this->head_) {
+    this->head_->pPrev_ = p_after_tail_;
+    this->tail_->pNext_ = p_after_tail_;
+    p_after_tail_->pNext_ = this->head_;
+    p_after_tail_->pPrev_ = this->tail_;
+  } else {
+    p_after_tail_->pNext_ = p_after_tail_->pPrev_ = nullptr;
+  }
 }
 
 template <typename T>
@@ -80,12 +91,8 @@ list<T>::list(size_type n) : list() {
 
 template <typename T>
 list<T>::list(std::initializer_list<T> const &items)
-    : LSQContainer<T>::LSQContainer(items) {
-  p_after_tail_ = new Node<T>();
-  this->head_->pPrev_ = p_after_tail_;
-  this->tail_->pNext_ = p_after_tail_;
-  p_after_tail_->pPrev_ = this->tail_;
-  p_after_tail_->pNext_ = this->head_;
+    : LSQContainer<T>::LSQContainer(items), p_after_tail_(this) {
+  link_sentinel();
 }
 
 template <typename T>
@@ -101,7 +108,8 @@ list<T>::list(const list &l) : list() {
 }
 
 template <typename T>
-list<T>::list(list &&l) : list() {
+list<T>::list(list &&l) noexcept(
+    std::is_nothrow_default_constructible<T>::value) : list() {
   *this = std::move(l);
 }
 
@@ -138,8 +146,7 @@ typename list<T>::size_type list<T>::max_size() const {
 }
 
 template <typename T>
-void list<T>::push_front(const_reference value) {
-  Node<T> *tmp = new Node<T>(value);
+void list<T>::link_front(Node<T> *tmp) {
   if (!this->head_ && !this->tail_) {
     this->head_ = this->tail_ = tmp;
     tmp->pNext_ = p_after_tail_;
@@ -156,6 +163,16 @@ void list<T>::push_front(const_reference value) {
   this->size_++;
 }
 
+template <typename T>
+void list<T>::push_front(const_reference value) {
+  link_front(new Node<T>(std::in_place, value));
+}
+
+template <typename T>
+void list<T>::push_front(value_type &&value) {
+  link_front(new Node<T>(std::in_place, std::move(value)));
+}
+
 template <typename T>
 void list<T>::pop_front() {
   if (this->head_ == nullptr) {
@@ -174,8 +191,7 @@ void list<T>::pop_front() {
 }
 
 template <typename T>
-void list<T>::push_back(const_reference value) {
-  Node<T> *tmp = new Node<T>(value);
+void list<T>::link_back(Node<T> *tmp) {
   if (!this->head_ && !this->tail_) {
     this->head_ = this->tail_ = tmp;
     tmp->pNext_ = p_after_tail_;
@@ -192,6 +208,16 @@ void list<T>::push_back(const_reference value) {
   this->size_++;
 }
 
+template <typename T>
+void list<T>::push_back(const_reference value) {
+  link_back(new Node<T>(std::in_place, value));
+}
+
+template <typename T>
+void list<T>::push_back(value_type &&value) {
+  link_back(new Node<T>(std::in_place, std::move(value)));
+}
+
 template <typename T>
 void list<T>::pop_back() {
   if (this->tail_ == nullptr) {
@@ -221,7 +247,8 @@ void list<T>::swap(list &other) {
   std::swap(this->size_, other.size_);
   std::swap(this->head_, other.head_);
   std::swap(this->tail_, other.tail_);
-  std::swap(this->p_after_tail_, other.p_after_tail_);
+  link_sentinel();
+  other.link_sentinel();
 }
 
 template <typename T>
@@ -242,24 +269,19 @@ void list<T>::reverse() {
 }
 
 template <typename T>
-list<T> &list<T>::operator=(list<T> &&l) {
-  if (this == &l)
-    throw std::invalid_argument("error sfleta_operator=: moving object to itself");
+list<T> &list<T>::operator=(list<T> &&l) noexcept {
+  if (this == &l) return *this;
 
-  if (!this->empty()) {
-    this->clear();
-  }
-  delete p_after_tail_;
+  this->clear();
 
   this->head_ = l.head_;
   this->tail_ = l.tail_;
   this->size_ = l.size_;
-  this->p_after_tail_ = l.p_after_tail_;
+  link_sentinel();
 
-  l.p_after_tail_->pNext_ = nullptr;
-  l.p_after_tail_->pPrev_ = nullptr;
-  l.head_ = l.tail_ = l.p_after_tail_ = nullptr;
+  l.head_ = l.tail_ = nullptr;
   l.size_ = 0;
+  l.link_sentinel();
 
   return *this;
 }
@@ -387,20 +409,13 @@ void list<T>::unique() {
 }
 
 template <typename T>
-typename list<T>::listIterator list<T>::insert(iterator pos,
-                                               const_reference value) {
-  Node<T> *tmp;
-  if (this->empty()) {
-    this->push_front(value);
-    tmp = this->head_;
-  } else if (pos.pNode_ == this->head_) {
-    this->push_front(value);
-    tmp = this->head_;
+typename list<T>::listIterator list<T>::link_before(iterator pos,
+                                                    Node<T> *tmp) {
+  if (this->empty() || pos.pNode_ == this->head_) {
+    link_front(tmp);
   } else if (pos.pNode_ == this->p_after_tail_) {
-    this->push_back(value);
-    tmp = this->tail_;
+    link_back(tmp);
   } else {
-    tmp = new Node<T>(value);
     tmp->pNext_ = pos.pNode_;
     tmp->pPrev_ = pos.pNode_->pPrev_;
 
@@ -411,6 +426,18 @@ typename list<T>::listIterator list<T>::insert(iterator pos,
   return iterator(tmp);
 }
 
+template <typename T>
+typename list<T>::listIterator list<T>::insert(iterator pos,
+                                               const_reference value) {
+  return link_before(pos, new Node<T>(std::in_place, value));
+}
+
+template <typename T>
+typename list<T>::listIterator list<T>::insert(iterator pos,
+                                               value_type &&value) {
+  return link_before(pos, new Node<T>(std::in_place, std::move(value)));
+}
+
 template <typename T>
 void list<T>::merge(list &other) {
   if (this->empty()) {
@@ -458,51 +485,23 @@ template <typename T>
 template <typename... Args>
 typename list<T>::listIterator list<T>::emplace(const_iterator pos,
                                                 Args &&...args) {
-  list<T> tmp_l{args...};
-  size_t size_args = tmp_l.size();
-  iterator tmp_it;
-  if (size_args == 0) {
-    Node<T> *tmp_n = new Node<T>();
-    tmp_it = this->insert(pos, tmp_n->data_);
-    delete tmp_n;
-  } else {
-    for (iterator i = tmp_l.begin(); i != tmp_l.end(); ++i) {
-      tmp_it = this->insert(pos, *i);
-    }
-  }
-  return tmp_it;
+  return link_before(pos, new Node<T>(std::in_place, std::forward<Args>(args)...));
 }
 
 template <typename T>
 template <typename... Args>
-void list<T>::emplace_back(Args &&...args) {
-  list<T> tmp_l{args...};
-  size_t size_args = tmp_l.size();
-  if (size_args == 0) {
-    Node<T> *tmp_n = new Node<T>();
-    this->push_back(tmp_n->data_);
-    delete tmp_n;
-  } else {
-    for (iterator i = tmp_l.begin(); i != tmp_l.end(); ++i) {
-      this->push_back(*i);
-    }
-  }
+typename list<T>::reference list<T>::emplace_back(Args &&...args) {
+  Node<T> *tmp = new Node<T>(std::in_place, std::forward<Args>(args)...);
+  link_back(tmp);
+  return tmp->data_;
 }
 
 template <typename T>
 template <typename... Args>
-void list<T>::emplace_front(Args &&...args) {
-  list<T> tmp_l{args...};
-  size_t size_args = tmp_l.size();
-  if (size_args == 0) {
-    Node<T> *tmp_n = new Node<T>();
-    this->push_front(tmp_n->data_);
-    delete tmp_n;
-  } else {
-    for (iterator i = --tmp_l.end(); i != --tmp_l.begin(); --i) {
-      this->push_front(*i);
-    }
-  }
+typename list<T>::reference list<T>::emplace_front(Args &&...args) {
+  Node<T> *tmp = new Node<T>(std::in_place, std::forward<Args>(args)...);
+  link_front(tmp);
+  return tmp->data_;
 }
 
 template <typename T>
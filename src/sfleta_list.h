@@ -2,6 +2,7 @@
 #define SRC_sfleta_LIST_H_
 #include <exception>
 #include <limits>
+#include <type_traits>
 
 #include "LSQContainer.h"
 namespace sfleta_ {
@@ -43,18 +44,20 @@ class list : public LSQContainer<T> {
   using const_iterator = listConstIterator;
 
  private:
+  // Sentinel is the list's own Node<T> base, so construction never allocates.
   Node<T> *p_after_tail_;
+  void link_sentinel() noexcept;
+  void link_front(Node<T> *node);
+  void link_back(Node<T> *node);
+  iterator link_before(iterator pos, Node<T> *node);
 
  public:
-  list();
+  list() noexcept(std::is_nothrow_default_constructible<T>::value);
   explicit list(size_type n);
   explicit list(std::initializer_list<T> const &items);
   list(const list &l);
-  list(list &&l);
-  ~list() {
-    clear();
-    delete p_after_tail_;
-  }
+  list(list &&l) noexcept(std::is_nothrow_default_constructible<T>::value);
+  ~list() { clear(); }
 
   const_reference front() const;
   const_reference back() const;
@@ -63,13 +66,15 @@ class list : public LSQContainer<T> {
   size_type max_size() const;
 
   void push_front(const_reference value);
+  void push_front(value_type &&value);
   void pop_front();
   void push_back(const_reference value);
+  void push_back(value_type &&value);
   void pop_back();
   void clear();
   void swap(list &other);
   void reverse();
-  list<T> &operator=(list &&l);
+  list<T> &operator=(list &&l) noexcept;
 
   bool empty() const;
   iterator begin();
@@ -81,15 +86,16 @@ class list : public LSQContainer<T> {
   void erase(iterator pos);
   void unique();
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
   void merge(list &other);
   void splice(const_iterator pos, list &other);
 
   template <typename... Args>
   iterator emplace(const_iterator pos, Args &&...args);
   template <typename... Args>
-  void emplace_back(Args &&...args);
+  reference emplace_back(Args &&...args);
   template <typename... Args>
-  void emplace_front(Args &&...args);
+  reference emplace_front(Args &&...args);
 
   void print();
 };
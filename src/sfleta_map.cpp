@@ -14,6 +14,19 @@ std::pair<typename Tree<K, T>::Iterator, bool> Map<K, T>::insert(const K& key, c
     return result;
 }
 
+template <typename K, typename T>
+std::pair<typename Tree<K, T>::Iterator, bool> Map<K, T>::insert(value_type&& value) {
+    auto result = Tree<K, T>::FindContains(value.first);
+    if (result.second) {
+        result.second = !result.second;
+        return result;
+    }
+    result.first = Tree<K, T>::insert(std::move(value.first));
+    result.first.node_->data_->second = std::move(value.second);
+    result.second = !result.second;
+    return result;
+}
+
 template <typename K, typename T>
 std::pair<typename Tree<K, T>::Iterator, bool> Map<K, T>::insert_or_assign(const K& key, const T& obj) {
     auto result = Tree<K, T>::FindContains(key);
@@ -56,20 +69,6 @@ T& Map<K, T>::at(const K& key) {
     return (*this)[key];
 }
 
-template <typename K, typename T>
-template <typename ... Args>
-vector<std::pair<typename Tree<K, T>::Iterator, bool>> Map<K, T>::emplace(Args&&... args) {
-    vector<std::pair<typename Tree<K, T>::Iterator, bool>> result;
-    const auto args_list = { args... };
-    for (auto it = args_list.begin(); it != args_list.end();) {
-        auto tmp = *it;
-        ++it;
-        result.push_back(insert(tmp, *it));
-        ++it;
-    }
-    return result;
-}
-
 template <typename K, typename T>
 Map<K, T>& Map<K, T>::operator=(Map<K, T>&& other) {
     if (this->root_) {
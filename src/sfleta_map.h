@@ -29,8 +29,9 @@ class Map : public Tree<K, T> {
     explicit Map(std::initializer_list<value_type> const& items) { for (auto& value : items) insert(value); }
 
     template <typename ... Args>
-    vector<std::pair<iterator, bool>> emplace(Args&&... args);
+    std::pair<iterator, bool> emplace(Args&&... args) { return insert(value_type(std::forward<Args>(args)...)); }
     std::pair<iterator, bool> insert(const_reference value) { return insert(value.first, value.second); }
+    std::pair<iterator, bool> insert(value_type&& value);
     std::pair<iterator, bool> insert_or_assign(const K& key, const T& obj);
     std::pair<iterator, bool> insert(const K& key, const T& obj);
     Map<K, T>& operator=(Map<K, T>&& other);
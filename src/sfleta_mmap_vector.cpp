@@ -0,0 +1,211 @@
+namespace sfleta_ {
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::fail(const char* what) {
+    throw std::system_error(errno, std::generic_category(), std::string("error sfleta_mmap_vector: ") + what);
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::check_writable() const {
+    if (read_only_) {
+        throw std::logic_error("error sfleta_mmap_vector: vector is opened read-only");
+    }
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::attach(void* mapping) {
+    header_ = static_cast<mmap_header*>(mapping);
+    this->buffer_ = reinterpret_cast<T*>(static_cast<char*>(mapping) + kHeaderBytes);
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::validate(size_type bytes) {
+    if (bytes < kHeaderBytes || header_->magic != kMagic) {
+        throw std::runtime_error("error sfleta_mmap_vector: file is not an mmap_vector file");
+    }
+    if (header_->element_size != sizeof(T) || (bytes - kHeaderBytes) % sizeof(T) != 0) {
+        throw std::runtime_error("error sfleta_mmap_vector: file element size does not match");
+    }
+    capacity_ = (bytes - kHeaderBytes) / sizeof(T);
+    if (header_->size > capacity_) {
+        throw std::runtime_error("error sfleta_mmap_vector: stored size is past the end of the file");
+    }
+    this->size_ = header_->size;
+}
+
+template <typename T, typename Growth>
+mmap_vector<T, Growth>::mmap_vector(const std::string& path, open_mode mode)
+    : header_(nullptr), capacity_(0), fd_(-1), read_only_(mode == open_mode::read_only) {
+    int flags = read_only_ ? O_RDONLY : O_RDWR | O_CREAT;
+    if (mode == open_mode::create) flags |= O_TRUNC;
+    fd_ = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+    if (fd_ < 0) fail("open");
+    size_type bytes = 0;
+    try {
+        struct stat st;
+        if (::fstat(fd_, &st) != 0) fail("fstat");
+        bytes = static_cast<size_type>(st.st_size);
+        if (bytes == 0 && read_only_) {
+            return;
+        }
+        if (bytes == 0) {
+            bytes = file_bytes(0);
+            if (::ftruncate(fd_, static_cast<off_t>(bytes)) != 0) fail("ftruncate");
+        }
+        // a private writable mapping keeps stores through operator[] and data()
+        // from faulting when the file itself is read-only; MAP_NORESERVE stops
+        // the kernel from reserving memory for the whole file up front
+        int share = read_only_ ? MAP_PRIVATE | MAP_NORESERVE : MAP_SHARED;
+        void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, share, fd_, 0);
+        if (p == MAP_FAILED) fail("mmap");
+        attach(p);
+        if (st.st_size == 0) {
+            *header_ = mmap_header{kMagic, sizeof(T), 0};
+        }
+        validate(bytes);
+    } catch (...) {
+        if (header_) ::munmap(header_, bytes);
+        ::close(fd_);
+        throw;
+    }
+}
+
+template <typename T, typename Growth>
+mmap_vector<T, Growth>::mmap_vector(mmap_vector&& v) noexcept
+    : header_(v.header_), capacity_(v.capacity_), fd_(v.fd_), read_only_(v.read_only_) {
+    this->buffer_ = v.buffer_;
+    this->size_ = v.size_;
+    v.header_ = nullptr;
+    v.buffer_ = nullptr;
+    v.size_ = v.capacity_ = 0;
+    v.fd_ = -1;
+}
+
+template <typename T, typename Growth>
+mmap_vector<T, Growth>& mmap_vector<T, Growth>::operator=(mmap_vector&& v) noexcept {
+    if (this != &v) {
+        close();
+        swap(v);
+    }
+    return *this;
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::close() noexcept {
+    if (fd_ < 0) return;
+    if (header_) {
+        if (!read_only_) header_->size = this->size_;
+        ::munmap(header_, file_bytes(capacity_));
+    }
+    if (!read_only_) {
+        // drop the reserved tail so the file holds exactly the elements
+        int rc = ::ftruncate(fd_, static_cast<off_t>(file_bytes(this->size_)));
+        (void)rc;
+    }
+    ::close(fd_);
+    header_ = nullptr;
+    this->buffer_ = nullptr;
+    this->size_ = capacity_ = 0;
+    fd_ = -1;
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::remap(size_type new_capacity) {
+    size_type old_bytes = file_bytes(capacity_);
+    size_type new_bytes = file_bytes(new_capacity);
+    // the file must cover the mapping before it grows and may only shrink after it
+    if (new_bytes > old_bytes && ::ftruncate(fd_, static_cast<off_t>(new_bytes)) != 0) fail("ftruncate");
+#ifdef __linux__
+    void* p = ::mremap(header_, old_bytes, new_bytes, MREMAP_MAYMOVE);
+#else
+    void* p = ::mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (p != MAP_FAILED) ::munmap(header_, old_bytes);
+#endif
+    if (p == MAP_FAILED) {
+        int saved = errno;
+        int rc = ::ftruncate(fd_, static_cast<off_t>(old_bytes));
+        (void)rc;
+        errno = saved;
+        fail("mremap");
+    }
+    attach(p);
+    capacity_ = new_capacity;
+    if (new_bytes < old_bytes && ::ftruncate(fd_, static_cast<off_t>(new_bytes)) != 0) fail("ftruncate");
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::reserve(size_type size) {
+    check_writable();
+    if (size > capacity_) {
+        if (size > this->max_size()) {
+            throw std::length_error("error sfleta_mmap_vector: reserve over maximum size");
+        }
+        remap(size);
+    }
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::shrink_to_fit() {
+    check_writable();
+    if (capacity_ > this->size_) remap(this->size_);
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::resize(size_type count, const_reference value) {
+    check_writable();
+    if (count > capacity_) remap(count);
+    for (size_type i = this->size_; i < count; ++i) new (this->buffer_ + i) T(value);
+    this->size_ = count;
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::clear() {
+    check_writable();
+    this->size_ = 0;
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::push_back(const_reference value) {
+    emplace_back(value);
+}
+
+template <typename T, typename Growth>
+template <typename... Args>
+typename mmap_vector<T, Growth>::reference mmap_vector<T, Growth>::emplace_back(Args&&... args) {
+    check_writable();
+    if (this->size_ == capacity_) {
+        // value may refer into the mapping that remap moves
+        T tmp(std::forward<Args>(args)...);
+        remap(Growth::next(capacity_, this->size_ + 1));
+        return *new (this->buffer_ + this->size_++) T(tmp);
+    }
+    return *new (this->buffer_ + this->size_++) T(std::forward<Args>(args)...);
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::pop_back() {
+    check_writable();
+    if (this->size_ > 0) this->size_--;
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::swap(mmap_vector& other) noexcept {
+    std::swap(header_, other.header_);
+    std::swap(this->buffer_, other.buffer_);
+    std::swap(this->size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(fd_, other.fd_);
+    std::swap(read_only_, other.read_only_);
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::sync(bool wait) {
+    if (read_only_ || header_ == nullptr) {
+        return;
+    }
+    int flags = wait ? MS_SYNC : MS_ASYNC;
+    // the elements first, then the count that makes them part of the file
+    if (::msync(header_, file_bytes(this->size_), flags) != 0) fail("msync");
+    header_->size = this->size_;
+    if (::msync(header_, kHeaderBytes, flags) != 0) fail("msync");
+}
+}  // namespace sfleta_
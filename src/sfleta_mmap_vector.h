@@ -0,0 +1,101 @@
+#ifndef SRC_sfleta_MMAP_VECTOR_H_
+#define SRC_sfleta_MMAP_VECTOR_H_
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include "sfleta_vector.h"
+namespace sfleta_ {
+enum class open_mode {
+    read_only,   // maps an existing file copy-on-write: elements may be changed in
+                 // memory but never reach the file, modifiers throw std::logic_error;
+                 // only the pages written to take memory, so files larger than
+                 // memory open fine
+    read_write,  // opens or creates the file and keeps its contents
+    create       // creates the file or truncates an existing one
+};
+
+// Start of an mmap_vector file. size is the element count as of the last
+// sync() or close(); elements past it are unused capacity.
+struct mmap_header {
+    uint64_t magic;
+    uint64_t element_size;
+    uint64_t size;
+};
+
+// vector whose elements live in a shared file mapping. The file holds a
+// header_size() byte header followed by the raw elements: its length is
+// header_size() + size() * sizeof(T) once the vector is closed, and
+// header_size() + capacity() * sizeof(T) while it is open. Elements added
+// after the last sync() are dropped if the process dies before close().
+template <typename T, typename Growth = growth_double>
+class mmap_vector : public VA_Container<T> {
+    static_assert(std::is_trivially_copyable_v<T>, "mmap_vector needs trivially copyable elements");
+
+ public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using size_type = size_t;
+
+ private:
+    static constexpr uint64_t kMagic = 0x31564d4154454c46;  // "FLETAMV1"
+    // keeps the elements after the header aligned
+    static constexpr size_type kHeaderBytes = alignof(T) > 64 ? alignof(T) : 64;
+
+    mmap_header* header_;
+    size_type capacity_;
+    int fd_;
+    bool read_only_;
+
+    [[noreturn]] static void fail(const char* what);
+    void check_writable() const;
+    static size_type file_bytes(size_type capacity) { return kHeaderBytes + capacity * sizeof(T); }
+    void attach(void* mapping);
+    // checks the header of a mapped file of the given length, sets size_ and capacity_
+    void validate(size_type bytes);
+    // resizes the file and the mapping to hold new_capacity elements
+    void remap(size_type new_capacity);
+    void close() noexcept;
+
+ public:
+    explicit mmap_vector(const std::string& path, open_mode mode = open_mode::read_write);
+    mmap_vector(const mmap_vector&) = delete;
+    mmap_vector& operator=(const mmap_vector&) = delete;
+    mmap_vector(mmap_vector&& v) noexcept;
+    mmap_vector& operator=(mmap_vector&& v) noexcept;
+    ~mmap_vector() { close(); }
+
+    static constexpr size_type header_size() noexcept { return kHeaderBytes; }
+    bool read_only() const noexcept { return read_only_; }
+    size_type capacity() const noexcept { return capacity_; }
+    void reserve(size_type size);
+    void shrink_to_fit();
+    void resize(size_type count, const_reference value = value_type());
+    void clear();
+
+    void push_back(const_reference value);
+    template <typename... Args>
+    reference emplace_back(Args&&... args);
+    void pop_back();
+    void swap(mmap_vector& other) noexcept;
+
+    // writes the elements back to the file, then records size() in the header.
+    // With wait set both steps complete in that order before it returns, so the
+    // file never counts elements that did not reach it.
+    void sync(bool wait = true);
+};
+}  // namespace sfleta_
+#include "sfleta_mmap_vector.cpp"
+#endif  // SRC_sfleta_MMAP_VECTOR_H_
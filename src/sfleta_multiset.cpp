@@ -36,15 +36,4 @@ multiset<K>::equal_range(const K& key) {
     res.second = upper_bound(key);
     return res;
 }
-
-template <typename K>
-template <typename... Args>
-vector<typename multiset<K>::iterator> multiset<K>::emplace(Args&&... args) {
-    vector<typename multiset<K>::iterator> vec;
-    const auto args_list = { args... };
-    for (auto it = args_list.begin(); it != args_list.end(); ++it) {
-        vec.push_back(insert(*it));
-    }
-    return vec;
-}
 }  // namespace sfleta_
@@ -23,9 +23,12 @@ class multiset : public set<K> {
     if (this->set_) {delete this->set_;}
     this->set_ = std::move(ms.set_); ms.set_ = nullptr; return *this;}
     iterator insert(const value_type& value) {return this->set_->insert(value);}
+    iterator insert(value_type&& value) {return this->set_->insert(std::move(value));}
     template <typename... Args>
-    vector<iterator> emplace(Args&&... args);
+    iterator emplace(Args&&... args) {return insert(value_type(std::forward<Args>(args)...));}
     void merge(const multiset& other) {this->set_->merge(other.set_, 0);}
+    // Like set::assign_sorted, but equal keys may repeat.
+    void assign_sorted(const vector<value_type>& keys) {this->set_->assign_sorted(keys.data(), keys.size());}
     size_type count(const_reference key);
     std::pair<iterator, iterator> equal_range(const_reference key);
     iterator lower_bound(const_reference key);
@@ -0,0 +1,214 @@
+namespace sfleta_ {
+namespace parallel {
+namespace detail {
+// splits [0, n) into count non-empty chunks of near equal size
+struct chunking {
+    thread_pool* pool;
+    size_t n;
+    size_t count;
+    size_t begin(size_t c) const { return c * (n / count) + std::min(c, n % count); }
+};
+
+// at least one grain per task and a few tasks per thread for balance
+inline chunking plan(size_t n, const parallel_options& opt) {
+    thread_pool* pool = opt.pool ? opt.pool : &thread_pool::global();
+    size_t grain = std::max<size_t>(opt.grain, 1);
+    size_t count = std::min(n / grain + (n % grain != 0), 4 * (pool->size() + 1));
+    return chunking{pool, n, std::max<size_t>(count, 1)};
+}
+
+// calls body(c) for every chunk, chunk 0 on the calling thread
+template <typename Body>
+void run_chunks(const chunking& ch, Body&& body) {
+    if (ch.count == 1) {
+        body(size_t(0));
+        return;
+    }
+    task_group group(*ch.pool);
+    for (size_t c = 1; c < ch.count; ++c) group.run([&body, c] { body(c); });
+    body(size_t(0));
+    group.wait();
+}
+
+// moves the merge of sorted [a0, a1) and [b0, b1) to out as independent pieces:
+// every piece of the longer range is paired with the part of the other range
+// that sorts before its successor
+template <typename It, typename OutIt, typename Compare>
+void merge_split(task_group& group, It a0, It a1, It b0, It b1, OutIt out, Compare comp, size_t pieces) {
+    if (a1 - a0 < b1 - b0) {
+        std::swap(a0, b0);
+        std::swap(a1, b1);
+    }
+    size_t na = a1 - a0;
+    It pa = a0;
+    It pb = b0;
+    for (size_t k = 1; k <= pieces; ++k) {
+        It qa = k == pieces ? a1 : a0 + na * k / pieces;
+        It qb = k == pieces ? b1 : std::lower_bound(pb, b1, *qa, comp);
+        OutIt dest = out + ((pa - a0) + (pb - b0));
+        group.run([=] {
+            std::merge(std::make_move_iterator(pa), std::make_move_iterator(qa), std::make_move_iterator(pb),
+                       std::make_move_iterator(qb), dest, comp);
+        });
+        pa = qa;
+        pb = qb;
+    }
+}
+
+// merges neighbouring sorted runs of src into dst, halving the run count
+template <typename SrcIt, typename DstIt, typename Compare>
+void merge_round(SrcIt src, DstIt dst, std::vector<size_t>& bounds, Compare comp, const chunking& ch) {
+    size_t piece = std::max<size_t>(ch.n / ch.count, 1);
+    size_t runs = bounds.size() - 1;
+    std::vector<size_t> next;
+    task_group group(*ch.pool);
+    for (size_t r = 0; r < runs; r += 2) {
+        size_t end = r + 1 < runs ? bounds[r + 2] : bounds[r + 1];
+        size_t pieces = std::max<size_t>((end - bounds[r]) / piece, 1);
+        merge_split(group, src + bounds[r], src + bounds[r + 1], src + bounds[r + 1], src + end, dst + bounds[r],
+                    comp, pieces);
+        next.push_back(bounds[r]);
+    }
+    next.push_back(bounds.back());
+    group.wait();
+    bounds.swap(next);
+}
+
+// spans of positions read as one sequence
+struct span_list {
+    std::vector<size_t> from{};
+    std::vector<size_t> offset{0};
+    void add(size_t b, size_t e) {
+        if (b >= e) return;
+        from.push_back(b);
+        offset.push_back(offset.back() + (e - b));
+    }
+    size_t size() const { return offset.back(); }
+};
+
+// swaps the k-th elements of both span sequences for k in [k0, k1)
+template <typename RandomIt>
+void swap_spans(RandomIt first, const span_list& x, const span_list& y, size_t k0, size_t k1) {
+    size_t ix = std::upper_bound(x.offset.begin(), x.offset.end(), k0) - x.offset.begin() - 1;
+    size_t iy = std::upper_bound(y.offset.begin(), y.offset.end(), k0) - y.offset.begin() - 1;
+    for (size_t k = k0; k < k1; ++k) {
+        if (k == x.offset[ix + 1]) ++ix;
+        if (k == y.offset[iy + 1]) ++iy;
+        std::iter_swap(first + (x.from[ix] + k - x.offset[ix]), first + (y.from[iy] + k - y.offset[iy]));
+    }
+}
+}  // namespace detail
+
+template <typename RandomIt, typename F>
+void for_each(RandomIt first, RandomIt last, F f, const parallel_options& opt) {
+    detail::chunking ch = detail::plan(last - first, opt);
+    detail::run_chunks(ch, [&](size_t c) { std::for_each(first + ch.begin(c), first + ch.begin(c + 1), f); });
+}
+
+template <typename RandomIt, typename OutIt, typename F>
+OutIt transform(RandomIt first, RandomIt last, OutIt out, F f, const parallel_options& opt) {
+    detail::chunking ch = detail::plan(last - first, opt);
+    detail::run_chunks(ch, [&](size_t c) {
+        std::transform(first + ch.begin(c), first + ch.begin(c + 1), out + ch.begin(c), f);
+    });
+    return out + (last - first);
+}
+
+template <typename RandomIt, typename T, typename BinaryOp>
+T reduce(RandomIt first, RandomIt last, T init, BinaryOp op, const parallel_options& opt) {
+    if (first == last) return init;
+    detail::chunking ch = detail::plan(last - first, opt);
+    std::vector<std::optional<T>> partial(ch.count);
+    detail::run_chunks(ch, [&](size_t c) {
+        RandomIt b = first + ch.begin(c);
+        partial[c].emplace(std::accumulate(b + 1, first + ch.begin(c + 1), T(*b), op));
+    });
+    for (auto& value : partial) init = op(std::move(init), std::move(*value));
+    return init;
+}
+
+template <typename RandomIt, typename OutIt, typename BinaryOp>
+OutIt inclusive_scan(RandomIt first, RandomIt last, OutIt out, BinaryOp op, const parallel_options& opt) {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    detail::chunking ch = detail::plan(last - first, opt);
+    if (ch.count == 1) return std::inclusive_scan(first, last, out, op);
+    // totals of every chunk but the last, turned into running carries
+    std::vector<std::optional<T>> carry(ch.count - 1);
+    detail::run_chunks(ch, [&](size_t c) {
+        if (c + 1 == ch.count) return;
+        RandomIt b = first + ch.begin(c);
+        carry[c].emplace(std::accumulate(b + 1, first + ch.begin(c + 1), T(*b), op));
+    });
+    for (size_t c = 1; c < carry.size(); ++c) carry[c] = op(*carry[c - 1], *carry[c]);
+    detail::run_chunks(ch, [&](size_t c) {
+        size_t b = ch.begin(c);
+        size_t e = ch.begin(c + 1);
+        if (c == 0) {
+            std::inclusive_scan(first + b, first + e, out + b, op);
+            return;
+        }
+        T acc = *carry[c - 1];
+        for (size_t i = b; i < e; ++i) {
+            acc = op(std::move(acc), first[i]);
+            out[i] = acc;
+        }
+    });
+    return out + (last - first);
+}
+
+template <typename RandomIt, typename Compare>
+void sort(RandomIt first, RandomIt last, Compare comp, const parallel_options& opt) {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    size_t n = last - first;
+    detail::chunking ch = detail::plan(n, opt);
+    if (ch.count == 1) {
+        std::sort(first, last, comp);
+        return;
+    }
+    detail::run_chunks(ch, [&](size_t c) { std::sort(first + ch.begin(c), first + ch.begin(c + 1), comp); });
+    std::unique_ptr<T[]> buffer(new T[n]);
+    std::vector<size_t> bounds(ch.count + 1);
+    for (size_t c = 0; c <= ch.count; ++c) bounds[c] = ch.begin(c);
+    bool in_buffer = false;
+    while (bounds.size() > 2) {
+        if (in_buffer) {
+            detail::merge_round(buffer.get(), first, bounds, comp, ch);
+        } else {
+            detail::merge_round(first, buffer.get(), bounds, comp, ch);
+        }
+        in_buffer = !in_buffer;
+    }
+    if (in_buffer) {
+        detail::run_chunks(ch, [&](size_t c) {
+            std::move(buffer.get() + ch.begin(c), buffer.get() + ch.begin(c + 1), first + ch.begin(c));
+        });
+    }
+}
+
+template <typename RandomIt, typename Pred>
+RandomIt partition(RandomIt first, RandomIt last, Pred pred, const parallel_options& opt) {
+    detail::chunking ch = detail::plan(last - first, opt);
+    if (ch.count == 1) return std::partition(first, last, pred);
+    std::vector<size_t> split(ch.count);
+    detail::run_chunks(ch, [&](size_t c) {
+        split[c] = std::partition(first + ch.begin(c), first + ch.begin(c + 1), pred) - first;
+    });
+    size_t total = 0;
+    for (size_t c = 0; c < ch.count; ++c) total += split[c] - ch.begin(c);
+    // false elements before total and true elements after it trade places
+    detail::span_list misplaced_false;
+    detail::span_list misplaced_true;
+    for (size_t c = 0; c < ch.count; ++c) {
+        misplaced_false.add(split[c], std::min(ch.begin(c + 1), total));
+        misplaced_true.add(std::max(ch.begin(c), total), split[c]);
+    }
+    parallel_options swap_opt = opt;
+    swap_opt.pool = ch.pool;
+    detail::chunking swaps = detail::plan(misplaced_false.size(), swap_opt);
+    detail::run_chunks(swaps, [&](size_t c) {
+        detail::swap_spans(first, misplaced_false, misplaced_true, swaps.begin(c), swaps.begin(c + 1));
+    });
+    return first + total;
+}
+}  // namespace parallel
+}  // namespace sfleta_
@@ -0,0 +1,50 @@
+#ifndef SRC_sfleta_PARALLEL_H_
+#define SRC_sfleta_PARALLEL_H_
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <vector>
+#include "sfleta_thread_pool.h"
+namespace sfleta_ {
+struct parallel_options {
+    // smallest number of elements handed to one task
+    size_t grain = 16384;
+    // pool running the tasks, nullptr for thread_pool::global()
+    thread_pool* pool = nullptr;
+};
+
+// Parallel counterparts of the std algorithms for random access ranges such
+// as vector and array iterators. Ranges up to one grain run on the calling
+// thread. Exceptions thrown by the callables propagate to the caller after
+// all started tasks have finished.
+namespace parallel {
+template <typename RandomIt, typename F>
+void for_each(RandomIt first, RandomIt last, F f, const parallel_options& opt = {});
+
+template <typename RandomIt, typename OutIt, typename F>
+OutIt transform(RandomIt first, RandomIt last, OutIt out, F f, const parallel_options& opt = {});
+
+// op must be associative, chunks are combined in order
+template <typename RandomIt, typename T, typename BinaryOp = std::plus<>>
+T reduce(RandomIt first, RandomIt last, T init, BinaryOp op = BinaryOp(), const parallel_options& opt = {});
+
+// out may equal first; op must be associative
+template <typename RandomIt, typename OutIt, typename BinaryOp = std::plus<>>
+OutIt inclusive_scan(RandomIt first, RandomIt last, OutIt out, BinaryOp op = BinaryOp(),
+                     const parallel_options& opt = {});
+
+// unstable: sorts chunks in parallel and merges them pairwise with split merges.
+// The value type must be default constructible for the merge buffer.
+template <typename RandomIt, typename Compare = std::less<>>
+void sort(RandomIt first, RandomIt last, Compare comp = Compare(), const parallel_options& opt = {});
+
+// unstable, returns the first element for which pred is false
+template <typename RandomIt, typename Pred>
+RandomIt partition(RandomIt first, RandomIt last, Pred pred, const parallel_options& opt = {});
+}  // namespace parallel
+}  // namespace sfleta_
+#include "sfleta_parallel.cpp"
+#endif  // SRC_sfleta_PARALLEL_H_
@@ -0,0 +1,112 @@
+namespace sfleta_ {
+namespace detail {
+template <size_t Size>
+struct radix_uint;
+template <>
+struct radix_uint<1> { using type = uint8_t; };
+template <>
+struct radix_uint<2> { using type = uint16_t; };
+template <>
+struct radix_uint<4> { using type = uint32_t; };
+template <>
+struct radix_uint<8> { using type = uint64_t; };
+
+// maps a key to an unsigned integer with the same order
+template <typename K>
+typename radix_uint<sizeof(K)>::type radix_key(K key) {
+    using U = typename radix_uint<sizeof(K)>::type;
+    constexpr U kSign = U(U(1) << (sizeof(U) * 8 - 1));
+    if constexpr (std::is_floating_point_v<K>) {
+        U bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        return (bits & kSign) ? U(~bits) : U(bits | kSign);
+    } else if constexpr (std::is_signed_v<K>) {
+        return U(U(key) ^ kSign);
+    } else {
+        return U(key);
+    }
+}
+
+template <typename T, typename KeyFn>
+void radix_histogram(const T* data, size_t n, KeyFn& key, unsigned bits, unsigned passes, size_t* counts) {
+    size_t radix = size_t(1) << bits;
+    size_t mask = radix - 1;
+    for (size_t i = 0; i < n; ++i) {
+        auto k = radix_key(key(data[i]));
+        for (unsigned p = 0; p < passes; ++p) ++counts[p * radix + ((k >> (p * bits)) & mask)];
+    }
+}
+
+template <typename T, typename KeyFn>
+void radix_sort_range(T* data, size_t n, KeyFn key, const radix_options& opt) {
+    using K = std::decay_t<decltype(key(*data))>;
+    static_assert(std::is_arithmetic_v<K> && !std::is_same_v<K, long double>,
+                  "radix_sort needs integer or floating point keys");
+    if (opt.digit_bits < 1 || opt.digit_bits > 16) {
+        throw std::invalid_argument("error sfleta_radix_sort: digit_bits must be between 1 and 16");
+    }
+    if (n < 2) return;
+    const unsigned bits = opt.digit_bits;
+    const unsigned passes = (sizeof(K) * 8 + bits - 1) / bits;
+    const size_t radix = size_t(1) << bits;
+    const size_t mask = radix - 1;
+    if (n < 64) {
+        std::stable_sort(data, data + n, [&key](const T& a, const T& b) { return radix_key(key(a)) < radix_key(key(b)); });
+        return;
+    }
+
+    std::vector<size_t> counts(passes * radix);
+    if (opt.parallel_histogram) {
+        parallel::detail::chunking ch = parallel::detail::plan(n, opt.parallel);
+        // one private table per thread rather than per chunk keeps memory bounded
+        ch.count = std::min(ch.count, ch.pool->size() + 1);
+        std::vector<std::vector<size_t>> local(ch.count, std::vector<size_t>(passes * radix));
+        parallel::detail::run_chunks(ch, [&](size_t c) {
+            KeyFn chunk_key = key;
+            radix_histogram(data + ch.begin(c), ch.begin(c + 1) - ch.begin(c), chunk_key, bits, passes, local[c].data());
+        });
+        for (auto& table : local) {
+            for (size_t j = 0; j < counts.size(); ++j) counts[j] += table[j];
+        }
+    } else {
+        radix_histogram(data, n, key, bits, passes, counts.data());
+    }
+
+    std::unique_ptr<T[]> scratch;
+    T* src = data;
+    T* dst = nullptr;
+    for (unsigned p = 0; p < passes; ++p) {
+        size_t* count = counts.data() + p * radix;
+        unsigned shift = p * bits;
+        // every key shares this digit, the pass would not move anything
+        if (count[(radix_key(key(src[0])) >> shift) & mask] == n) continue;
+        if (!scratch) {
+            scratch.reset(new T[n]);
+            dst = scratch.get();
+        }
+        size_t offset = 0;
+        for (size_t d = 0; d < radix; ++d) {
+            size_t bucket = count[d];
+            count[d] = offset;
+            offset += bucket;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            dst[count[(radix_key(key(src[i])) >> shift) & mask]++] = std::move(src[i]);
+        }
+        std::swap(src, dst);
+    }
+    if (src != data) std::move(src, src + n, data);
+}
+}  // namespace detail
+
+template <typename C>
+void radix_sort(C& c, const radix_options& opt) {
+    using T = std::remove_reference_t<decltype(*c.data())>;
+    detail::radix_sort_range(c.data(), c.size(), [](const T& x) { return x; }, opt);
+}
+
+template <typename C, typename KeyFn, typename>
+void radix_sort(C& c, KeyFn key, const radix_options& opt) {
+    detail::radix_sort_range(c.data(), c.size(), key, opt);
+}
+}  // namespace sfleta_
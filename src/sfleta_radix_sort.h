@@ -0,0 +1,33 @@
+#ifndef SRC_sfleta_RADIX_SORT_H_
+#define SRC_sfleta_RADIX_SORT_H_
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "sfleta_parallel.h"
+namespace sfleta_ {
+struct radix_options {
+    // bits sorted per pass, 1 to 16; 8, 11 and 16 split 32/64-bit keys evenly
+    unsigned digit_bits = 8;
+    // counts the digits of all passes on the pool given by parallel
+    bool parallel_histogram = false;
+    parallel_options parallel{};
+};
+
+// Stable LSD radix sort of a contiguous container (vector, small_vector,
+// array) of integers or floats, or of records by a key returning one.
+// Floats order as -NaN < -inf < ... < -0.0 < +0.0 < ... < +inf < +NaN.
+// Records must be default constructible and move assignable: passes go back
+// and forth between the container and one scratch buffer.
+template <typename C>
+void radix_sort(C& c, const radix_options& opt = {});
+template <typename C, typename KeyFn,
+          typename = std::enable_if_t<!std::is_same_v<std::decay_t<KeyFn>, radix_options>>>
+void radix_sort(C& c, KeyFn key, const radix_options& opt = {});
+}  // namespace sfleta_
+#include "sfleta_radix_sort.cpp"
+#endif  // SRC_sfleta_RADIX_SORT_H_
@@ -12,13 +12,20 @@ std::pair<typename set<K>::iterator, bool> set<K>::insert(const K& value) {
 }
 
 template <typename K>
-template <typename... Args>
-vector<std::pair<typename set<K>::iterator, bool>> set<K>::emplace(Args&&... args) {
-    vector<std::pair<typename set<K>::iterator, bool>> vec;
-    const auto args_list = { args... };
-    for (auto it = args_list.begin(); it != args_list.end(); ++it) {
-        vec.push_back(insert(*it));
+std::pair<typename set<K>::iterator, bool> set<K>::insert(K&& value) {
+    std::pair<set<K>::iterator, bool> res;
+    res.second = !contains(value);
+    if (res.second) {
+        res.first = set_->insert(std::move(value));
+    } else {
+        res.first = find(value);
     }
-    return vec;
+    return res;
+}
+
+template <typename K>
+template <typename... Args>
+std::pair<typename set<K>::iterator, bool> set<K>::emplace(Args&&... args) {
+    return insert(value_type(std::forward<Args>(args)...));
 }
 }  // namespace sfleta_
@@ -35,14 +35,25 @@ class set {
 
     void clear() {set_->clear();}
     std::pair<iterator, bool> insert(const value_type& value);
+    std::pair<iterator, bool> insert(value_type&& value);
     template <typename... Args>
-    vector<std::pair<iterator, bool>> emplace(Args&&... args);
+    std::pair<iterator, bool> emplace(Args&&... args);
     void erase(iterator pos) {set_->erase(pos);}
     void swap(const set& other) {set_->swap(*other.set_);}
     void merge(const set& other) {set_->merge(other.set_, 1);}
 
     iterator find(const_reference key) {return set_->find(key);}
     bool contains(const_reference key) {return set_->contains(key);}
+    iterator lower_bound_from(iterator hint, const_reference key) const
+    {return set_->LowerBoundFrom(hint, key);}
+    // Replaces the contents with keys that are already sorted, in linear time.
+    // The keys must be strictly increasing; checked by assert in debug builds.
+    void assign_sorted(const vector<value_type>& keys) {
+        assert(std::adjacent_find(keys.data(), keys.data() + keys.size(),
+                                  [](const K& a, const K& b) { return !(a < b); }) == keys.data() + keys.size() &&
+               "set::assign_sorted needs strictly increasing keys");
+        set_->assign_sorted(keys.data(), keys.size());
+    }
 };
 }  // namespace sfleta_
 #include "sfleta_set.cpp"
@@ -0,0 +1,198 @@
+namespace sfleta_ {
+template <typename K>
+void UnionKeys(const set<K>& a, const set<K>& b, vector<K>* out) {
+    out->reserve(a.size() + b.size());
+    auto it1 = a.begin(), end1 = a.end();
+    auto it2 = b.begin(), end2 = b.end();
+    while (it1 != end1 && it2 != end2) {
+        const K key1 = *it1, key2 = *it2;
+        if (key1 < key2) {
+            out->push_back(key1);
+            ++it1;
+        } else if (key2 < key1) {
+            out->push_back(key2);
+            ++it2;
+        } else {
+            out->push_back(key1);
+            ++it1;
+            ++it2;
+        }
+    }
+    for (; it1 != end1; ++it1) out->push_back(*it1);
+    for (; it2 != end2; ++it2) out->push_back(*it2);
+}
+
+template <typename K>
+void IntersectionKeys(const set<K>& a, const set<K>& b, vector<K>* out) {
+    const set<K>& small = a.size() <= b.size() ? a : b;
+    const set<K>& large = a.size() <= b.size() ? b : a;
+    const bool gallop = small.size() * kGallopRatio < large.size();
+    out->reserve(small.size());
+    auto it1 = small.begin(), end1 = small.end();
+    auto it2 = large.begin(), end2 = large.end();
+    while (it1 != end1 && it2 != end2) {
+        const K key1 = *it1, key2 = *it2;
+        if (key1 < key2) {
+            ++it1;
+        } else if (key2 < key1) {
+            if (gallop) {
+                it2 = large.lower_bound_from(it2, key1);
+            } else {
+                ++it2;
+            }
+        } else {
+            out->push_back(key1);
+            ++it1;
+            ++it2;
+        }
+    }
+}
+
+template <typename K>
+void DifferenceKeys(const set<K>& a, const set<K>& b, vector<K>* out) {
+    const bool gallop = a.size() * kGallopRatio < b.size();
+    out->reserve(a.size());
+    auto it1 = a.begin(), end1 = a.end();
+    auto it2 = b.begin(), end2 = b.end();
+    while (it1 != end1 && it2 != end2) {
+        const K key1 = *it1, key2 = *it2;
+        if (key1 < key2) {
+            out->push_back(key1);
+            ++it1;
+        } else if (key2 < key1) {
+            if (gallop) {
+                it2 = b.lower_bound_from(it2, key1);
+            } else {
+                ++it2;
+            }
+        } else {
+            ++it1;
+            ++it2;
+        }
+    }
+    for (; it1 != end1; ++it1) out->push_back(*it1);
+}
+
+template <typename K>
+void SymmetricDifferenceKeys(const set<K>& a, const set<K>& b, vector<K>* out) {
+    out->reserve(a.size() + b.size());
+    auto it1 = a.begin(), end1 = a.end();
+    auto it2 = b.begin(), end2 = b.end();
+    while (it1 != end1 && it2 != end2) {
+        const K key1 = *it1, key2 = *it2;
+        if (key1 < key2) {
+            out->push_back(key1);
+            ++it1;
+        } else if (key2 < key1) {
+            out->push_back(key2);
+            ++it2;
+        } else {
+            ++it1;
+            ++it2;
+        }
+    }
+    for (; it1 != end1; ++it1) out->push_back(*it1);
+    for (; it2 != end2; ++it2) out->push_back(*it2);
+}
+
+template <typename K>
+set<K> set_union(const set<K>& a, const set<K>& b) {
+    vector<K> keys;
+    UnionKeys(a, b, &keys);
+    set<K> result;
+    result.assign_sorted(keys);
+    return result;
+}
+
+template <typename K>
+set<K> set_intersection(const set<K>& a, const set<K>& b) {
+    vector<K> keys;
+    IntersectionKeys(a, b, &keys);
+    set<K> result;
+    result.assign_sorted(keys);
+    return result;
+}
+
+template <typename K>
+set<K> set_difference(const set<K>& a, const set<K>& b) {
+    vector<K> keys;
+    DifferenceKeys(a, b, &keys);
+    set<K> result;
+    result.assign_sorted(keys);
+    return result;
+}
+
+template <typename K>
+set<K> set_symmetric_difference(const set<K>& a, const set<K>& b) {
+    vector<K> keys;
+    SymmetricDifferenceKeys(a, b, &keys);
+    set<K> result;
+    result.assign_sorted(keys);
+    return result;
+}
+
+template <typename K>
+multiset<K> set_union(const multiset<K>& a, const multiset<K>& b) {
+    vector<K> keys;
+    UnionKeys<K>(a, b, &keys);
+    multiset<K> result;
+    result.assign_sorted(keys);
+    return result;
+}
+
+template <typename K>
+multiset<K> set_intersection(const multiset<K>& a, const multiset<K>& b) {
+    vector<K> keys;
+    IntersectionKeys<K>(a, b, &keys);
+    multiset<K> result;
+    result.assign_sorted(keys);
+    return result;
+}
+
+template <typename K>
+multiset<K> set_difference(const multiset<K>& a, const multiset<K>& b) {
+    vector<K> keys;
+    DifferenceKeys<K>(a, b, &keys);
+    multiset<K> result;
+    result.assign_sorted(keys);
+    return result;
+}
+
+template <typename K>
+multiset<K> set_symmetric_difference(const multiset<K>& a, const multiset<K>& b) {
+    vector<K> keys;
+    SymmetricDifferenceKeys<K>(a, b, &keys);
+    multiset<K> result;
+    result.assign_sorted(keys);
+    return result;
+}
+
+template <typename K>
+bool includes(const set<K>& a, const set<K>& b) {
+    if (b.size() > a.size()) {
+        return false;
+    }
+    const bool gallop = b.size() * kGallopRatio < a.size();
+    auto it1 = a.begin(), end1 = a.end();
+    auto it2 = b.begin(), end2 = b.end();
+    while (it2 != end2) {
+        if (it1 == end1) {
+            return false;
+        }
+        const K key1 = *it1, key2 = *it2;
+        if (key2 < key1) {
+            return false;
+        } else if (key1 < key2) {
+            if (gallop) {
+                it1 = a.lower_bound_from(it1, key2);
+            } else {
+                ++it1;
+            }
+        } else {
+            ++it1;
+            ++it2;
+        }
+    }
+    return true;
+}
+}  // namespace sfleta_
@@ -0,0 +1,32 @@
+#ifndef SRC_sfleta_SET_ALGEBRA_H_
+#define SRC_sfleta_SET_ALGEBRA_H_
+#include "sfleta_multiset.h"
+namespace sfleta_ {
+// Size ratio above which the smaller operand drives the merge and the larger
+// one is skipped through with finger (galloping) search instead of ++.
+constexpr size_t kGallopRatio = 16;
+
+template <typename K>
+set<K> set_union(const set<K>& a, const set<K>& b);
+template <typename K>
+set<K> set_intersection(const set<K>& a, const set<K>& b);
+template <typename K>
+set<K> set_difference(const set<K>& a, const set<K>& b);
+template <typename K>
+set<K> set_symmetric_difference(const set<K>& a, const set<K>& b);
+
+template <typename K>
+multiset<K> set_union(const multiset<K>& a, const multiset<K>& b);
+template <typename K>
+multiset<K> set_intersection(const multiset<K>& a, const multiset<K>& b);
+template <typename K>
+multiset<K> set_difference(const multiset<K>& a, const multiset<K>& b);
+template <typename K>
+multiset<K> set_symmetric_difference(const multiset<K>& a, const multiset<K>& b);
+
+// true if every element of b (with multiplicity) is in a
+template <typename K>
+bool includes(const set<K>& a, const set<K>& b);
+}  // namespace sfleta_
+#include "sfleta_set_algebra.cpp"
+#endif  // SRC_sfleta_SET_ALGEBRA_H_
@@ -0,0 +1,286 @@
+namespace sfleta_ {
+namespace simd {
+namespace detail {
+struct scalar_kernels {
+    template <typename T>
+    static size_t find(const T* p, size_t n, T value) {
+        size_t i = 0;
+        while (i < n && !(p[i] == value)) ++i;
+        return i;
+    }
+
+    template <typename T>
+    static size_t count(const T* p, size_t n, T value) {
+        size_t total = 0;
+        for (size_t i = 0; i < n; ++i) total += p[i] == value;
+        return total;
+    }
+
+    // same order of comparisons as std::min_element/std::max_element
+    template <typename T, bool kMax>
+    static size_t extremum(const T* p, size_t n) {
+        if (n == 0) return 0;
+        size_t best = 0;
+        for (size_t i = 1; i < n; ++i) {
+            if (kMax ? p[best] < p[i] : p[i] < p[best]) best = i;
+        }
+        return best;
+    }
+
+    template <typename T>
+    static T sum(const T* p, size_t n) {
+        using A = acc_lane_t<T>;
+        A s = A();
+        for (size_t i = 0; i < n; ++i) s += static_cast<A>(p[i]);
+        return static_cast<T>(s);
+    }
+
+    template <typename T>
+    static T dot(const T* a, const T* b, size_t n) {
+        using A = acc_lane_t<T>;
+        using P = prod_lane_t<T>;
+        A s = A();
+        for (size_t i = 0; i < n; ++i) s += static_cast<A>(static_cast<P>(a[i]) * static_cast<P>(b[i]));
+        return static_cast<T>(s);
+    }
+
+    template <typename T>
+    static void fill(T* p, size_t n, T value) {
+        for (size_t i = 0; i < n; ++i) p[i] = value;
+    }
+
+    template <typename T>
+    static bool equal(const T* a, const T* b, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            if (!(a[i] == b[i])) return false;
+        }
+        return true;
+    }
+    template <bit_op Op, typename T>
+    static void bitwise(T* a, const T* b, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            if constexpr (Op == bit_op::and_op) {
+                a[i] &= b[i];
+            } else if constexpr (Op == bit_op::or_op) {
+                a[i] |= b[i];
+            } else {
+                a[i] ^= b[i];
+            }
+        }
+    }
+
+    template <typename T>
+    static size_t popcount(const T* p, size_t n) {
+        size_t total = 0;
+        for (size_t i = 0; i < n; ++i) total += __builtin_popcountll(p[i]);
+        return total;
+    }
+};
+
+#if SFLETA_SIMD_X86
+#pragma GCC push_options
+#pragma GCC target("sse2")
+namespace sse2 {
+constexpr size_t kBytes = 16;
+#include "sfleta_simd_kernels.inl"
+}  // namespace sse2
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+namespace avx2 {
+constexpr size_t kBytes = 32;
+#include "sfleta_simd_kernels.inl"
+}  // namespace avx2
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512bw,avx512vl,avx512dq")
+namespace avx512 {
+constexpr size_t kBytes = 64;
+#include "sfleta_simd_kernels.inl"
+}  // namespace avx512
+#pragma GCC pop_options
+#endif
+
+inline isa detect() noexcept {
+#if SFLETA_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512dq")) {
+        return isa::avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) return isa::avx2;
+    if (__builtin_cpu_supports("sse2")) return isa::sse2;
+#endif
+    return isa::scalar;
+}
+
+inline std::atomic<isa>& active_level() noexcept {
+    static std::atomic<isa> level(detected_isa());
+    return level;
+}
+
+// calls f with the kernel set of the active instruction set
+template <typename T, typename F>
+decltype(auto) dispatch(F&& f) {
+#if SFLETA_SIMD_X86
+    if constexpr (kVectorizable<T>) {
+        switch (active_isa()) {
+            case isa::avx512:
+                return f(avx512::kernels{});
+            case isa::avx2:
+                return f(avx2::kernels{});
+            case isa::sse2:
+                return f(sse2::kernels{});
+            case isa::scalar:
+                break;
+        }
+    }
+#endif
+    return f(scalar_kernels{});
+}
+
+template <typename T, bool kMax>
+size_t extremum(const T* p, size_t n) {
+    size_t i = dispatch<T>([&](auto k) { return decltype(k)::template extremum<T, kMax>(p, n); });
+    // the vector kernels leave short ranges and ranges with NaN to the scalar loop
+    if (i == n) i = scalar_kernels::extremum<T, kMax>(p, n);
+    return i;
+}
+}  // namespace detail
+
+inline isa detected_isa() noexcept {
+    static const isa level = detail::detect();
+    return level;
+}
+
+inline isa active_isa() noexcept {
+    return detail::active_level().load(std::memory_order_relaxed);
+}
+
+inline void select_isa(isa level) {
+    if (level > detected_isa()) {
+        throw std::invalid_argument("error sfleta_select_isa: instruction set is not supported by this CPU");
+    }
+    detail::active_level().store(level, std::memory_order_relaxed);
+}
+
+template <typename C>
+detail::data_t<C> find(C& c, const detail::value_t<C>& value) {
+    using T = detail::value_t<C>;
+    static_assert(std::is_arithmetic_v<T>, "simd algorithms need an arithmetic value_type");
+    const T* p = c.data();
+    size_t i = detail::dispatch<T>([&](auto k) { return k.find(p, c.size(), value); });
+    return c.data() + i;
+}
+
+template <typename C>
+size_t count(const C& c, const detail::value_t<C>& value) {
+    using T = detail::value_t<C>;
+    static_assert(std::is_arithmetic_v<T>, "simd algorithms need an arithmetic value_type");
+    const T* p = c.data();
+    return detail::dispatch<T>([&](auto k) { return k.count(p, c.size(), value); });
+}
+
+template <typename C>
+bool contains(const C& c, const detail::value_t<C>& value) {
+    using T = detail::value_t<C>;
+    static_assert(std::is_arithmetic_v<T>, "simd algorithms need an arithmetic value_type");
+    const T* p = c.data();
+    return detail::dispatch<T>([&](auto k) { return k.find(p, c.size(), value); }) != c.size();
+}
+
+template <typename C>
+detail::data_t<C> min_element(C& c) {
+    using T = detail::value_t<C>;
+    static_assert(std::is_arithmetic_v<T>, "simd algorithms need an arithmetic value_type");
+    return c.data() + detail::extremum<T, false>(c.data(), c.size());
+}
+
+template <typename C>
+detail::data_t<C> max_element(C& c) {
+    using T = detail::value_t<C>;
+    static_assert(std::is_arithmetic_v<T>, "simd algorithms need an arithmetic value_type");
+    return c.data() + detail::extremum<T, true>(c.data(), c.size());
+}
+
+template <typename C>
+detail::value_t<C> sum(const C& c) {
+    using T = detail::value_t<C>;
+    static_assert(std::is_arithmetic_v<T>, "simd algorithms need an arithmetic value_type");
+    const T* p = c.data();
+    return detail::dispatch<T>([&](auto k) { return k.sum(p, c.size()); });
+}
+
+template <typename C1, typename C2>
+detail::value_t<C1> dot(const C1& a, const C2& b) {
+    using T = detail::value_t<C1>;
+    static_assert(std::is_arithmetic_v<T>, "simd algorithms need an arithmetic value_type");
+    static_assert(std::is_same_v<T, detail::value_t<C2>>, "dot needs containers of the same value_type");
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("error sfleta_dot: containers have different sizes");
+    }
+    const T* pa = a.data();
+    const T* pb = b.data();
+    return detail::dispatch<T>([&](auto k) { return k.dot(pa, pb, a.size()); });
+}
+
+template <typename C>
+void fill(C& c, const detail::value_t<C>& value) {
+    using T = detail::value_t<C>;
+    static_assert(std::is_arithmetic_v<T>, "simd algorithms need an arithmetic value_type");
+    T* p = c.data();
+    detail::dispatch<T>([&](auto k) { k.fill(p, c.size(), value); });
+}
+
+template <typename C1, typename C2>
+bool equal(const C1& a, const C2& b) {
+    using T = detail::value_t<C1>;
+    static_assert(std::is_arithmetic_v<T>, "simd algorithms need an arithmetic value_type");
+    static_assert(std::is_same_v<T, detail::value_t<C2>>, "equal needs containers of the same value_type");
+    if (a.size() != b.size()) return false;
+    const T* pa = a.data();
+    const T* pb = b.data();
+    return detail::dispatch<T>([&](auto k) { return k.equal(pa, pb, a.size()); });
+}
+
+template <detail::bit_op Op, typename C1, typename C2>
+void detail::bitwise(C1& a, const C2& b) {
+    using T = value_t<C1>;
+    static_assert(std::is_integral_v<T> && std::is_unsigned_v<T> && !std::is_same_v<T, bool>,
+                  "bitwise simd algorithms need unsigned integer words");
+    static_assert(std::is_same_v<T, value_t<C2>>, "bitwise simd algorithms need containers of the same value_type");
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("error sfleta_bitwise: containers have different sizes");
+    }
+    T* pa = a.data();
+    const T* pb = b.data();
+    dispatch<T>([&](auto k) { decltype(k)::template bitwise<Op>(pa, pb, a.size()); });
+}
+
+template <typename C1, typename C2>
+void and_assign(C1& a, const C2& b) {
+    detail::bitwise<detail::bit_op::and_op>(a, b);
+}
+
+template <typename C1, typename C2>
+void or_assign(C1& a, const C2& b) {
+    detail::bitwise<detail::bit_op::or_op>(a, b);
+}
+
+template <typename C1, typename C2>
+void xor_assign(C1& a, const C2& b) {
+    detail::bitwise<detail::bit_op::xor_op>(a, b);
+}
+
+template <typename C>
+size_t popcount(const C& c) {
+    using T = detail::value_t<C>;
+    static_assert(std::is_integral_v<T> && std::is_unsigned_v<T> && !std::is_same_v<T, bool>,
+                  "popcount needs unsigned integer words");
+    const T* p = c.data();
+    return detail::dispatch<T>([&](auto k) { return k.popcount(p, c.size()); });
+}
+}  // namespace simd
+}  // namespace sfleta_
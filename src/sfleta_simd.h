@@ -0,0 +1,128 @@
+#ifndef SRC_sfleta_SIMD_H_
+#define SRC_sfleta_SIMD_H_
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// The vector paths are built with GCC target pragmas and picked at run time,
+// other compilers and targets get the scalar loops only.
+#if defined(__GNUC__) && !defined(__clang__) && (defined(__x86_64__) || defined(__i386__))
+#define SFLETA_SIMD_X86 1
+#else
+#define SFLETA_SIMD_X86 0
+#endif
+
+namespace sfleta_ {
+// Vectorized algorithms over contiguous containers of arithmetic values
+// (vector, small_vector, array): anything exposing data() and size().
+namespace simd {
+enum class isa { scalar, sse2, avx2, avx512 };
+
+// best instruction set supported by the CPU and the OS
+isa detected_isa() noexcept;
+// instruction set the algorithms currently dispatch to
+isa active_isa() noexcept;
+// restricts dispatch to level, throws std::invalid_argument if the CPU lacks it
+void select_isa(isa level);
+
+namespace detail {
+template <typename C>
+using data_t = decltype(std::declval<C&>().data());
+template <typename C>
+using value_t = std::remove_cv_t<std::remove_pointer_t<data_t<C>>>;
+
+template <size_t Size>
+struct uint_of_size;
+template <>
+struct uint_of_size<1> { using type = uint8_t; };
+template <>
+struct uint_of_size<2> { using type = uint16_t; };
+template <>
+struct uint_of_size<4> { using type = uint32_t; };
+template <>
+struct uint_of_size<8> { using type = uint64_t; };
+
+template <typename T>
+using uint_lane_t = typename uint_of_size<sizeof(T)>::type;
+// integer sums and products wrap in the unsigned type instead of overflowing
+template <typename T, bool = std::is_integral_v<T>>
+struct lane_traits {
+    using acc = T;
+    using prod = T;
+};
+template <typename T>
+struct lane_traits<T, true> {
+    using acc = uint_lane_t<T>;
+    using prod = std::conditional_t<sizeof(T) < sizeof(unsigned), unsigned, acc>;
+};
+template <typename T>
+using acc_lane_t = typename lane_traits<T>::acc;
+template <typename T>
+using prod_lane_t = typename lane_traits<T>::prod;
+
+template <typename T>
+constexpr bool kVectorizable = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                               !std::is_same_v<T, long double> &&
+                               (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+template <typename T>
+constexpr bool is_nan(T x) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return x != x;
+    } else {
+        (void)x;
+        return false;
+    }
+}
+
+enum class bit_op { and_op, or_op, xor_op };
+
+struct scalar_kernels;
+template <typename T, typename F>
+decltype(auto) dispatch(F&& f);
+template <bit_op Op, typename C1, typename C2>
+void bitwise(C1& a, const C2& b);
+}  // namespace detail
+
+template <typename C>
+detail::data_t<C> find(C& c, const detail::value_t<C>& value);
+template <typename C>
+size_t count(const C& c, const detail::value_t<C>& value);
+template <typename C>
+bool contains(const C& c, const detail::value_t<C>& value);
+// first smallest/largest element like std::min_element, data() + size() if empty
+template <typename C>
+detail::data_t<C> min_element(C& c);
+template <typename C>
+detail::data_t<C> max_element(C& c);
+// accumulates in value_type, integers wrap around; floating point results may
+// differ from a sequential loop in the last bits since lanes add in parallel
+template <typename C>
+detail::value_t<C> sum(const C& c);
+// throws std::invalid_argument if the sizes differ
+template <typename C1, typename C2>
+detail::value_t<C1> dot(const C1& a, const C2& b);
+template <typename C>
+void fill(C& c, const detail::value_t<C>& value);
+template <typename C1, typename C2>
+bool equal(const C1& a, const C2& b);
+
+// word-wise a &= b, a |= b and a ^= b over unsigned integers;
+// throw std::invalid_argument if the sizes differ
+template <typename C1, typename C2>
+void and_assign(C1& a, const C2& b);
+template <typename C1, typename C2>
+void or_assign(C1& a, const C2& b);
+template <typename C1, typename C2>
+void xor_assign(C1& a, const C2& b);
+// number of set bits in a range of unsigned integers
+template <typename C>
+size_t popcount(const C& c);
+}  // namespace simd
+}  // namespace sfleta_
+
+#include "sfleta_simd.cpp"
+#endif  // SRC_sfleta_SIMD_H_
@@ -0,0 +1,229 @@
+// Kernel bodies shared by every instruction set. The including file opens
+// the ISA namespace, defines kBytes (the register width) and sets the
+// matching target pragma, so each inclusion compiles to its own code.
+
+template <typename U>
+struct lanes {
+    typedef U type __attribute__((vector_size(kBytes)));
+};
+
+template <typename V, typename U>
+inline V load(const U* p) {
+    V v;
+    __builtin_memcpy(&v, p, sizeof(V));
+    return v;
+}
+
+// broadcast through a loop, V{} + value would turn -0.0 into +0.0
+template <typename V, typename U>
+inline V splat(U value) {
+    V v;
+    for (size_t k = 0; k < sizeof(V) / sizeof(U); ++k) v[k] = value;
+    return v;
+}
+
+template <typename M>
+inline bool any_set(M m) {
+    using Q = typename lanes<unsigned long long>::type;
+    Q q = (Q)m;
+    unsigned long long r = 0;
+    for (size_t k = 0; k < sizeof(M) / sizeof(r); ++k) r |= q[k];
+    return r != 0;
+}
+
+// defined per instruction set, vector arguments must not cross a target boundary
+template <bit_op Op, typename V>
+inline V apply_bit_op(V a, V b) {
+    if constexpr (Op == bit_op::and_op) {
+        return a & b;
+    } else if constexpr (Op == bit_op::or_op) {
+        return a | b;
+    } else {
+        return a ^ b;
+    }
+}
+
+struct kernels {
+    template <typename T>
+    static size_t find(const T* p, size_t n, T value) {
+        using V = typename lanes<T>::type;
+        constexpr size_t L = kBytes / sizeof(T);
+        const V needle = splat<V>(value);
+        size_t i = 0;
+        for (; i + 4 * L <= n; i += 4 * L) {
+            auto m = (load<V>(p + i) == needle) | (load<V>(p + i + L) == needle) |
+                     (load<V>(p + i + 2 * L) == needle) | (load<V>(p + i + 3 * L) == needle);
+            if (any_set(m)) break;
+        }
+        for (; i + L <= n; i += L) {
+            if (any_set(load<V>(p + i) == needle)) break;
+        }
+        for (; i < n; ++i) {
+            if (p[i] == value) return i;
+        }
+        return n;
+    }
+
+    template <typename T>
+    static size_t count(const T* p, size_t n, T value) {
+        using V = typename lanes<T>::type;
+        using U = typename lanes<uint_lane_t<T>>::type;
+        constexpr size_t L = kBytes / sizeof(T);
+        // blocks a lane counter can take before it could wrap
+        constexpr size_t kFlush = sizeof(T) == 1 ? 255 : 65535;
+        const V needle = splat<V>(value);
+        size_t total = 0;
+        size_t i = 0;
+        while (i + L <= n) {
+            size_t blocks = (n - i) / L;
+            if (blocks > kFlush) blocks = kFlush;
+            U acc = U{};
+            for (size_t b = 0; b < blocks; ++b, i += L) acc -= (U)(load<V>(p + i) == needle);
+            for (size_t k = 0; k < L; ++k) total += acc[k];
+        }
+        for (; i < n; ++i) total += p[i] == value;
+        return total;
+    }
+
+    // index of the first smallest (kMax: largest) element, or n when the
+    // range is too short or holds a NaN and the caller has to do it in order
+    template <typename T, bool kMax>
+    static size_t extremum(const T* p, size_t n) {
+        using V = typename lanes<T>::type;
+        constexpr size_t L = kBytes / sizeof(T);
+        if (n < L) return n;
+        V best = load<V>(p);
+        auto nan = best < best;
+        if constexpr (std::is_floating_point_v<T>) nan = best != best;
+        size_t i = L;
+        for (; i + L <= n; i += L) {
+            V b = load<V>(p + i);
+            if constexpr (std::is_floating_point_v<T>) nan |= b != b;
+            if constexpr (kMax) {
+                best = best < b ? b : best;
+            } else {
+                best = b < best ? b : best;
+            }
+        }
+        if (any_set(nan)) return n;
+        T m = best[0];
+        for (size_t k = 1; k < L; ++k) {
+            if (kMax ? m < best[k] : best[k] < m) m = best[k];
+        }
+        for (; i < n; ++i) {
+            if (is_nan(p[i])) return n;
+            if (kMax ? m < p[i] : p[i] < m) m = p[i];
+        }
+        return find(p, n, m);
+    }
+
+    template <typename T>
+    static T sum(const T* p, size_t n) {
+        using A = acc_lane_t<T>;
+        using W = typename lanes<A>::type;
+        constexpr size_t L = kBytes / sizeof(T);
+        W a0 = W{}, a1 = W{}, a2 = W{}, a3 = W{};
+        size_t i = 0;
+        for (; i + 4 * L <= n; i += 4 * L) {
+            a0 += load<W>(p + i);
+            a1 += load<W>(p + i + L);
+            a2 += load<W>(p + i + 2 * L);
+            a3 += load<W>(p + i + 3 * L);
+        }
+        for (; i + L <= n; i += L) a0 += load<W>(p + i);
+        a0 = (a0 + a1) + (a2 + a3);
+        A s = 0;
+        for (size_t k = 0; k < L; ++k) s += a0[k];
+        for (; i < n; ++i) s += static_cast<A>(p[i]);
+        return static_cast<T>(s);
+    }
+
+    template <typename T>
+    static T dot(const T* a, const T* b, size_t n) {
+        using A = acc_lane_t<T>;
+        using P = prod_lane_t<T>;
+        using W = typename lanes<A>::type;
+        constexpr size_t L = kBytes / sizeof(T);
+        W a0 = W{}, a1 = W{};
+        size_t i = 0;
+        for (; i + 2 * L <= n; i += 2 * L) {
+            a0 += load<W>(a + i) * load<W>(b + i);
+            a1 += load<W>(a + i + L) * load<W>(b + i + L);
+        }
+        for (; i + L <= n; i += L) a0 += load<W>(a + i) * load<W>(b + i);
+        a0 += a1;
+        A s = 0;
+        for (size_t k = 0; k < L; ++k) s += a0[k];
+        for (; i < n; ++i) s += static_cast<A>(static_cast<P>(a[i]) * static_cast<P>(b[i]));
+        return static_cast<T>(s);
+    }
+
+    template <typename T>
+    static void fill(T* p, size_t n, T value) {
+        using V = typename lanes<T>::type;
+        constexpr size_t L = kBytes / sizeof(T);
+        const V v = splat<V>(value);
+        size_t i = 0;
+        for (; i + L <= n; i += L) __builtin_memcpy(p + i, &v, sizeof(V));
+        for (; i < n; ++i) p[i] = value;
+    }
+
+    template <typename T>
+    static bool equal(const T* a, const T* b, size_t n) {
+        using V = typename lanes<T>::type;
+        constexpr size_t L = kBytes / sizeof(T);
+        size_t i = 0;
+        for (; i + L <= n; i += L) {
+            if (any_set(load<V>(a + i) != load<V>(b + i))) return false;
+        }
+        for (; i < n; ++i) {
+            if (!(a[i] == b[i])) return false;
+        }
+        return true;
+    }
+
+    template <bit_op Op, typename T>
+    static void bitwise(T* a, const T* b, size_t n) {
+        using V = typename lanes<T>::type;
+        constexpr size_t L = kBytes / sizeof(T);
+        size_t i = 0;
+        for (; i + L <= n; i += L) {
+            V r = apply_bit_op<Op>(load<V>(a + i), load<V>(b + i));
+            __builtin_memcpy(a + i, &r, sizeof(V));
+        }
+        for (; i < n; ++i) a[i] = apply_bit_op<Op>(a[i], b[i]);
+    }
+
+    // bit counts per byte are summed in byte lanes for up to 31 blocks (8 * 31
+    // fits a byte), then widened to 64-bit lanes with shifts and masks
+    template <typename T>
+    static size_t popcount(const T* p, size_t n) {
+        using Q = typename lanes<unsigned long long>::type;
+        constexpr size_t L = kBytes / sizeof(T);
+        const Q m1 = splat<Q>(0x5555555555555555ull);
+        const Q m2 = splat<Q>(0x3333333333333333ull);
+        const Q m4 = splat<Q>(0x0f0f0f0f0f0f0f0full);
+        const Q m8 = splat<Q>(0x00ff00ff00ff00ffull);
+        const Q m16 = splat<Q>(0x0000ffff0000ffffull);
+        const Q m32 = splat<Q>(0x00000000ffffffffull);
+        size_t total = 0;
+        size_t i = 0;
+        while (i + L <= n) {
+            size_t blocks = (n - i) / L;
+            if (blocks > 31) blocks = 31;
+            Q acc = Q{};
+            for (size_t b = 0; b < blocks; ++b, i += L) {
+                Q x = load<Q>(p + i);
+                x = x - ((x >> 1) & m1);
+                x = (x & m2) + ((x >> 2) & m2);
+                acc += (x + (x >> 4)) & m4;
+            }
+            acc = (acc & m8) + ((acc >> 8) & m8);
+            acc = (acc & m16) + ((acc >> 16) & m16);
+            acc = (acc & m32) + (acc >> 32);
+            for (size_t k = 0; k < sizeof(Q) / sizeof(unsigned long long); ++k) total += acc[k];
+        }
+        for (; i < n; ++i) total += __builtin_popcountll(p[i]);
+        return total;
+    }
+};
@@ -0,0 +1,271 @@
+namespace sfleta_ {
+template <typename T, size_t N>
+T* small_vector<T, N>::allocate(size_type n) {
+    if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+    } else {
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::deallocate(T* p) {
+    if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        ::operator delete(p, std::align_val_t(alignof(T)));
+    } else {
+        ::operator delete(p);
+    }
+}
+
+template <typename T, size_t N>
+small_vector<T, N>::small_vector(size_type n) : small_vector() {
+    resize(n);
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::relocate_to(T* dest) {
+    if constexpr (kRelocatable) {
+        if (this->size_) {
+            std::memcpy(static_cast<void*>(dest), static_cast<void*>(this->buffer_), this->size_ * sizeof(T));
+        }
+    } else {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(this->buffer_, this->size_, dest);
+        } else {
+            std::uninitialized_copy_n(this->buffer_, this->size_, dest);
+        }
+        std::destroy_n(this->buffer_, this->size_);
+    }
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::grow(size_type new_capacity) {
+    if (new_capacity > this->max_size()) {
+        throw std::length_error("try make vector larger than max_size()");
+    }
+    T* new_buffer = allocate(new_capacity);
+    try {
+        relocate_to(new_buffer);
+    } catch (...) {
+        deallocate(new_buffer);
+        throw;
+    }
+    if (!is_inline()) {
+        deallocate(this->buffer_);
+    }
+    this->buffer_ = new_buffer;
+    capacity_ = new_capacity;
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::release() {
+    std::destroy_n(this->buffer_, this->size_);
+    if (!is_inline()) {
+        deallocate(this->buffer_);
+    }
+    this->buffer_ = inline_data();
+    this->size_ = 0;
+    capacity_ = N;
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::steal(small_vector& other) {
+    if (other.is_inline()) {
+        other.relocate_to(this->buffer_);
+        this->size_ = other.size_;
+        other.size_ = 0;
+    } else {
+        this->buffer_ = other.buffer_;
+        this->size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.buffer_ = other.inline_data();
+        other.size_ = 0;
+        other.capacity_ = N;
+    }
+}
+
+template <typename T, size_t N>
+small_vector<T, N>& small_vector<T, N>::operator=(const small_vector& v) {
+    if (this != &v) {
+        assign(v.buffer_, v.buffer_ + v.size_);
+    }
+    return *this;
+}
+
+template <typename T, size_t N>
+small_vector<T, N>& small_vector<T, N>::operator=(small_vector&& v)
+    noexcept(std::is_nothrow_move_constructible_v<T>) {
+    if (this != &v) {
+        release();
+        steal(v);
+    }
+    return *this;
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+typename small_vector<T, N>::iterator small_vector<T, N>::emplace_at(size_type index, Args&&... args) {
+    if (this->size_ < capacity_) {
+        return detail::emplace_in_place(this->buffer_, this->size_, capacity_, index, std::forward<Args>(args)...);
+    }
+    // args may refer into the buffer that is about to move
+    T value(std::forward<Args>(args)...);
+    grow(2 * capacity_);
+    return detail::emplace_in_place(this->buffer_, this->size_, capacity_, index, std::move(value));
+}
+
+template <typename T, size_t N>
+template <typename ForwardIt>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert_range(size_type index,
+    ForwardIt first, size_type count) {
+    if (count == 0) {
+        return this->buffer_ + index;
+    }
+    if (count > this->max_size() - this->size_) {
+        throw std::length_error("try make vector larger than max_size()");
+    }
+    if (this->size_ + count > capacity_) {
+        grow(std::max(2 * capacity_, this->size_ + count));
+    }
+    return detail::insert_in_place(this->buffer_, this->size_, capacity_, index, first, count);
+}
+
+template <typename T, size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(iterator pos,
+    size_type count, const_reference value) {
+    T copy(value);
+    return insert_range(pos - this->buffer_, FillIterator<T>(copy, 0), count);
+}
+
+template <typename T, size_t N>
+template <typename InputIt, typename>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(iterator pos,
+    InputIt first, InputIt last) {
+    size_type index = pos - this->buffer_;
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+        return insert_range(index, first, static_cast<size_type>(std::distance(first, last)));
+    } else {
+        return detail::insert_single_pass(*this, index, first, last);
+    }
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::assign(size_type count, const_reference value) {
+    T copy(value);
+    clear();
+    insert_range(0, FillIterator<T>(copy, 0), count);
+}
+
+template <typename T, size_t N>
+template <typename InputIt, typename>
+void small_vector<T, N>::assign(InputIt first, InputIt last) {
+    clear();
+    insert(this->buffer_, first, last);
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::reserve(size_type size) {
+    if (size > capacity_) {
+        grow(size);
+    }
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::shrink_to_fit() {
+    if (is_inline() || this->size_ == capacity_) {
+        return;
+    }
+    T* heap = this->buffer_;
+    T* target = this->size_ <= N ? inline_data() : allocate(this->size_);
+    try {
+        relocate_to(target);
+    } catch (...) {
+        if (target != inline_data()) deallocate(target);
+        throw;
+    }
+    deallocate(heap);
+    this->buffer_ = target;
+    capacity_ = this->size_ <= N ? N : this->size_;
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::resize(size_type count) {
+    if (count <= this->size_) {
+        std::destroy_n(this->buffer_ + count, this->size_ - count);
+    } else {
+        if (count > capacity_) {
+            grow(std::max(2 * capacity_, count));
+        }
+        std::uninitialized_value_construct_n(this->buffer_ + this->size_, count - this->size_);
+    }
+    this->size_ = count;
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::resize(size_type count, const_reference value) {
+    if (count <= this->size_) {
+        std::destroy_n(this->buffer_ + count, this->size_ - count);
+    } else {
+        T copy(value);
+        if (count > capacity_) {
+            grow(std::max(2 * capacity_, count));
+        }
+        std::uninitialized_fill_n(this->buffer_ + this->size_, count - this->size_, copy);
+    }
+    this->size_ = count;
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::clear() {
+    std::destroy_n(this->buffer_, this->size_);
+    this->size_ = 0;
+}
+
+template <typename T, size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::erase(iterator first, iterator last) {
+    size_type count = last - first;
+    if (count == 0) {
+        return first;
+    }
+    T* old_end = this->buffer_ + this->size_;
+    std::move(last, old_end, first);
+    std::destroy(old_end - count, old_end);
+    this->size_ -= count;
+    return first;
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::pop_back() {
+    if (this->size_ > 0) {
+        this->size_--;
+        this->buffer_[this->size_].~T();
+    }
+}
+
+template <typename T, size_t N>
+void small_vector<T, N>::swap(small_vector& other) {
+    if (!is_inline() && !other.is_inline()) {
+        std::swap(this->buffer_, other.buffer_);
+        std::swap(this->size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    } else {
+        small_vector tmp(std::move(*this));
+        *this = std::move(other);
+        other = std::move(tmp);
+    }
+}
+
+template <typename T, size_t N, typename Pred>
+size_t erase_if(small_vector<T, N>& v, Pred pred) {
+    auto new_end = std::remove_if(v.begin(), v.end(), pred);
+    size_t removed = v.end() - new_end;
+    v.erase(new_end, v.end());
+    return removed;
+}
+
+template <typename T, size_t N, typename U>
+size_t erase(small_vector<T, N>& v, const U& value) {
+    return erase_if(v, [&value](const T& item) { return item == value; });
+}
+}  // namespace sfleta_
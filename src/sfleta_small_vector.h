@@ -0,0 +1,95 @@
+#ifndef SRC_sfleta_SMALL_VECTOR_H_
+#define SRC_sfleta_SMALL_VECTOR_H_
+#include "sfleta_vector.h"
+namespace sfleta_ {
+// vector that keeps up to N elements in inline storage and moves them to
+// the heap only once the size grows past N.
+template <typename T, size_t N>
+class small_vector : public VA_Container<T> {
+    static_assert(N > 0, "small_vector needs room for at least one inline element");
+
+ public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using size_type = size_t;
+
+ private:
+    alignas(T) unsigned char storage_[N * sizeof(T)];
+    size_type capacity_;
+
+    static constexpr bool kRelocatable = is_trivially_relocatable<T>::value;
+    T* inline_data() { return reinterpret_cast<T*>(storage_); }
+    static T* allocate(size_type n);
+    static void deallocate(T* p);
+    // moves the live elements to raw dest and ends their lifetime in buffer_
+    void relocate_to(T* dest);
+    void grow(size_type new_capacity);
+    void release();
+    void steal(small_vector& other);
+    template <typename... Args>
+    iterator emplace_at(size_type index, Args&&... args);
+    template <typename ForwardIt>
+    iterator insert_range(size_type index, ForwardIt first, size_type count);
+
+ public:
+    small_vector() { this->buffer_ = inline_data(); capacity_ = N; }
+    explicit small_vector(size_type n);
+    explicit small_vector(std::initializer_list<value_type> const& items) : small_vector()
+    { insert_range(0, items.begin(), items.size()); }
+    small_vector(const small_vector& v) : small_vector() { insert_range(0, v.buffer_, v.size_); }
+    small_vector(small_vector&& v) noexcept(std::is_nothrow_move_constructible_v<T>) : small_vector()
+    { steal(v); }
+    ~small_vector() { release(); }
+    small_vector& operator=(const small_vector& v);
+    small_vector& operator=(small_vector&& v) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    // true while the elements live in the inline buffer
+    bool is_inline() const { return this->buffer_ == reinterpret_cast<const T*>(storage_); }
+    static constexpr size_type inline_capacity() { return N; }
+
+    void assign(size_type count, const_reference value);
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    void assign(InputIt first, InputIt last);
+    void assign(std::initializer_list<value_type> items) { assign(items.begin(), items.end()); }
+
+    void reserve(size_type size);
+    size_type capacity() const { return capacity_; }
+    void shrink_to_fit();
+    void resize(size_type count);
+    void resize(size_type count, const_reference value);
+
+    void clear();
+    iterator insert(iterator pos, const_reference value) { return emplace_at(pos - this->buffer_, value); }
+    iterator insert(iterator pos, value_type&& value) { return emplace_at(pos - this->buffer_, std::move(value)); }
+    iterator insert(iterator pos, size_type count, const_reference value);
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    iterator insert(iterator pos, InputIt first, InputIt last);
+    iterator insert(iterator pos, std::initializer_list<value_type> items)
+    { return insert_range(pos - this->buffer_, items.begin(), items.size()); }
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    void append(InputIt first, InputIt last) { insert(this->buffer_ + this->size_, first, last); }
+
+    void erase(iterator pos) { erase(pos, pos + 1); }
+    iterator erase(iterator first, iterator last);
+    void push_back(const_reference value) { emplace_at(this->size_, value); }
+    void push_back(value_type&& value) { emplace_at(this->size_, std::move(value)); }
+    void pop_back();
+    void swap(small_vector& other);
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    { return emplace_at(pos - this->buffer_, std::forward<Args>(args)...); }
+    template <typename... Args>
+    reference emplace_back(Args&&... args) { return *emplace_at(this->size_, std::forward<Args>(args)...); }
+};
+
+template <typename T, size_t N, typename Pred>
+size_t erase_if(small_vector<T, N>& v, Pred pred);
+template <typename T, size_t N, typename U>
+size_t erase(small_vector<T, N>& v, const U& value);
+}  // namespace sfleta_
+#include "sfleta_small_vector.cpp"
+#endif  // SRC_sfleta_SMALL_VECTOR_H_
@@ -0,0 +1,232 @@
+namespace sfleta_ {
+namespace detail {
+template <typename F, size_t... I>
+void for_each_index(F& f, std::index_sequence<I...>) {
+    (f(std::integral_constant<size_t, I>{}), ...);
+}
+}  // namespace detail
+
+template <typename... Fields>
+template <typename F>
+void soa_vector<Fields...>::for_each_field(F&& f) {
+    detail::for_each_index(f, std::index_sequence_for<Fields...>{});
+}
+
+template <typename... Fields>
+template <typename T>
+T* soa_vector<Fields...>::allocate(size_type n) {
+    if (n == 0) {
+        return nullptr;
+    }
+    if (n > std::numeric_limits<size_type>::max() / sizeof(T)) {
+        throw std::length_error("try make soa_vector larger than max_size()");
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(std::max(kColumnAlign, alignof(T)))));
+}
+
+template <typename... Fields>
+template <typename T>
+void soa_vector<Fields...>::deallocate(T* p) noexcept {
+    if (p) ::operator delete(p, std::align_val_t(std::max(kColumnAlign, alignof(T))));
+}
+
+// destroys the first size elements of the first built columns and frees every column
+template <typename... Fields>
+void soa_vector<Fields...>::release(std::tuple<Fields*...>& columns, size_type built, size_type size) noexcept {
+    for_each_field([&](auto i) {
+        if (i < built) std::destroy_n(std::get<i>(columns), size);
+        deallocate(std::get<i>(columns));
+        std::get<i>(columns) = nullptr;
+    });
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::reallocate(size_type new_capacity) {
+    // when any column may throw while moving, every copyable column is copied,
+    // so a failure leaves the old columns intact
+    constexpr bool kMoveAll = ((std::is_nothrow_move_constructible_v<Fields> ||
+                                !std::is_copy_constructible_v<Fields>) && ...);
+    std::tuple<Fields*...> fresh{};
+    size_type built = 0;
+    try {
+        for_each_field([&](auto i) { std::get<i>(fresh) = allocate<field_type<i>>(new_capacity); });
+        for_each_field([&](auto i) {
+            using T = field_type<i>;
+            T* src = std::get<i>(columns_);
+            T* dest = std::get<i>(fresh);
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                if (size_) std::memcpy(static_cast<void*>(dest), static_cast<const void*>(src), size_ * sizeof(T));
+            } else if constexpr (kMoveAll || !std::is_copy_constructible_v<T>) {
+                std::uninitialized_move_n(src, size_, dest);
+            } else {
+                std::uninitialized_copy_n(src, size_, dest);
+            }
+            ++built;
+        });
+    } catch (...) {
+        release(fresh, built, size_);
+        throw;
+    }
+    release(columns_, sizeof...(Fields), size_);
+    columns_ = fresh;
+    capacity_ = new_capacity;
+}
+
+template <typename... Fields>
+template <typename... Args>
+void soa_vector<Fields...>::construct_back(Args&&... args) {
+    assert(size_ < capacity_);
+    std::tuple<Args&&...> values(std::forward<Args>(args)...);
+    size_type built = 0;
+    try {
+        for_each_field([&](auto i) {
+            ::new (static_cast<void*>(std::get<i>(columns_) + size_))
+                field_type<i>(std::forward<std::tuple_element_t<i, std::tuple<Args...>>>(std::get<i>(values)));
+            ++built;
+        });
+    } catch (...) {
+        for_each_field([&](auto i) {
+            if (i < built) std::destroy_at(std::get<i>(columns_) + size_);
+        });
+        throw;
+    }
+    ++size_;
+}
+
+template <typename... Fields>
+soa_vector<Fields...>::soa_vector(size_type n) : soa_vector() {
+    resize(n);
+}
+
+template <typename... Fields>
+soa_vector<Fields...>::soa_vector(const soa_vector& other) : soa_vector() {
+    reserve(other.size_);
+    for (size_type pos = 0; pos < other.size_; ++pos) {
+        std::apply([&](const Fields*... column) { construct_back(column[pos]...); }, other.columns_);
+    }
+}
+
+template <typename... Fields>
+soa_vector<Fields...>::soa_vector(soa_vector&& other) noexcept
+    : columns_(other.columns_), size_(other.size_), capacity_(other.capacity_) {
+    other.columns_ = std::tuple<Fields*...>();
+    other.size_ = 0;
+    other.capacity_ = 0;
+}
+
+template <typename... Fields>
+soa_vector<Fields...>& soa_vector<Fields...>::operator=(const soa_vector& other) {
+    if (this != &other) {
+        soa_vector copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+template <typename... Fields>
+soa_vector<Fields...>& soa_vector<Fields...>::operator=(soa_vector&& other) noexcept {
+    if (this != &other) {
+        release(columns_, sizeof...(Fields), size_);
+        columns_ = other.columns_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.columns_ = std::tuple<Fields*...>();
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+    return *this;
+}
+
+template <typename... Fields>
+soa_vector<Fields...>::~soa_vector() {
+    release(columns_, sizeof...(Fields), size_);
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::reserve(size_type n) {
+    if (n > capacity_) {
+        reallocate(n);
+    }
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::shrink_to_fit() {
+    if (size_ < capacity_) {
+        reallocate(size_);
+    }
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::resize(size_type n) {
+    if (n <= size_) {
+        for_each_field([&](auto i) { std::destroy(std::get<i>(columns_) + n, std::get<i>(columns_) + size_); });
+        size_ = n;
+        return;
+    }
+    reserve(n);
+    while (size_ < n) construct_back(Fields()...);
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::clear() noexcept {
+    for_each_field([&](auto i) { std::destroy_n(std::get<i>(columns_), size_); });
+    size_ = 0;
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::operator[](size_type pos) noexcept {
+    assert(pos < size_);
+    return std::apply([pos](Fields*... column) { return reference(column[pos]...); }, columns_);
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::operator[](size_type pos) const noexcept {
+    assert(pos < size_);
+    return std::apply([pos](const Fields*... column) { return const_reference(column[pos]...); }, columns_);
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::at(size_type pos) {
+    if (pos >= size_) {
+        throw std::out_of_range("error sfleta_soa_vector: pos is out of bound");
+    }
+    return (*this)[pos];
+}
+
+template <typename... Fields>
+typename soa_vector<Fields...>::const_reference soa_vector<Fields...>::at(size_type pos) const {
+    if (pos >= size_) {
+        throw std::out_of_range("error sfleta_soa_vector: pos is out of bound");
+    }
+    return (*this)[pos];
+}
+
+template <typename... Fields>
+template <typename... Args>
+typename soa_vector<Fields...>::reference soa_vector<Fields...>::emplace_back(Args&&... args) {
+    static_assert(sizeof...(Args) == sizeof...(Fields), "emplace_back takes one argument per field");
+    if (size_ < capacity_) {
+        construct_back(std::forward<Args>(args)...);
+    } else {
+        // the arguments may refer into the columns, build the row before they move
+        value_type row(std::forward<Args>(args)...);
+        reallocate(growth_double::next(capacity_, size_ + 1));
+        std::apply([this](Fields&... field) { construct_back(std::move(field)...); }, row);
+    }
+    return (*this)[size_ - 1];
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::pop_back() {
+    if (size_ > 0) {
+        resize(size_ - 1);
+    }
+}
+
+template <typename... Fields>
+void soa_vector<Fields...>::swap(soa_vector& other) noexcept {
+    std::swap(columns_, other.columns_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+}
+}  // namespace sfleta_
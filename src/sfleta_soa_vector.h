@@ -0,0 +1,214 @@
+#ifndef SRC_sfleta_SOA_VECTOR_H_
+#define SRC_sfleta_SOA_VECTOR_H_
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "sfleta_vector.h"
+namespace sfleta_ {
+// Contiguous view of one column, usable with the simd and parallel algorithms.
+template <typename T>
+class column_span {
+ public:
+    using value_type = std::remove_cv_t<T>;
+    using iterator = T*;
+    using size_type = size_t;
+
+    column_span(T* data, size_type size) noexcept : data_(data), size_(size) {}
+    T* data() const noexcept { return data_; }
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    T* begin() const noexcept { return data_; }
+    T* end() const noexcept { return data_ + size_; }
+    T& operator[](size_type pos) const noexcept {
+        assert(pos < size_);
+        return data_[pos];
+    }
+
+ private:
+    T* data_;
+    size_type size_;
+};
+
+// One row of an soa_vector: a tuple of references into the columns that
+// assigns and swaps the referenced values rather than rebinding, so row
+// iterators work with std::sort, std::reverse and the other mutating
+// algorithms. std::get and structured bindings see it as the tuple it is.
+template <typename... Refs>
+class soa_row : public std::tuple<Refs...> {
+    using base = std::tuple<Refs...>;
+
+ public:
+    using value_type = std::tuple<std::remove_cv_t<std::remove_reference_t<Refs>>...>;
+    using base::base;
+    soa_row(const soa_row&) = default;
+
+    // rows are temporaries handed out by operator[] and the iterators: assigning
+    // one copies the values it refers to
+    soa_row& operator=(const soa_row& other) {
+        base::operator=(other);
+        return *this;
+    }
+    soa_row& operator=(soa_row&& other) {
+        base::operator=(other);
+        return *this;
+    }
+    template <typename... Us>
+    soa_row& operator=(const std::tuple<Us...>& values) {
+        base::operator=(values);
+        return *this;
+    }
+    template <typename... Us>
+    soa_row& operator=(std::tuple<Us...>&& values) {
+        base::operator=(std::move(values));
+        return *this;
+    }
+
+    // swaps the referenced values, taken by value so it applies to the rows of
+    // two dereferenced iterators
+    friend void swap(soa_row a, soa_row b) {
+        swap_fields(a, b, std::index_sequence_for<Refs...>());
+    }
+
+ private:
+    template <size_t... I>
+    static void swap_fields(soa_row& a, soa_row& b, std::index_sequence<I...>) {
+        using std::swap;
+        (swap(std::get<I>(a), std::get<I>(b)), ...);
+    }
+};
+
+// Structure of arrays: every field lives in its own 64-byte aligned column,
+// all columns share one size and capacity and grow together. Rows are
+// accessed through soa_row, a tuple of references.
+template <typename... Fields>
+class soa_vector {
+    static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+
+ public:
+    using value_type = std::tuple<Fields...>;
+    using reference = soa_row<Fields&...>;
+    using const_reference = soa_row<const Fields&...>;
+    using size_type = size_t;
+    template <size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+
+    template <bool Const>
+    class row_iterator {
+        using owner = std::conditional_t<Const, const soa_vector, soa_vector>;
+
+     public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = soa_vector::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, soa_vector::const_reference, soa_vector::reference>;
+        using pointer = void;
+
+        row_iterator() : owner_(nullptr), pos_(0) {}
+        row_iterator(owner* v, size_type pos) : owner_(v), pos_(pos) {}
+        reference operator*() const { return (*owner_)[pos_]; }
+        reference operator[](difference_type n) const { return (*owner_)[pos_ + n]; }
+        row_iterator& operator++() { ++pos_; return *this; }
+        row_iterator operator++(int) { row_iterator tmp(*this); ++pos_; return tmp; }
+        row_iterator& operator--() { --pos_; return *this; }
+        row_iterator operator--(int) { row_iterator tmp(*this); --pos_; return tmp; }
+        row_iterator& operator+=(difference_type n) { pos_ += n; return *this; }
+        row_iterator& operator-=(difference_type n) { pos_ -= n; return *this; }
+        row_iterator operator+(difference_type n) const { return row_iterator(owner_, pos_ + n); }
+        row_iterator operator-(difference_type n) const { return row_iterator(owner_, pos_ - n); }
+        difference_type operator-(const row_iterator& other) const {
+            return static_cast<difference_type>(pos_) - static_cast<difference_type>(other.pos_);
+        }
+        bool operator==(const row_iterator& other) const { return pos_ == other.pos_; }
+        bool operator!=(const row_iterator& other) const { return pos_ != other.pos_; }
+        bool operator<(const row_iterator& other) const { return pos_ < other.pos_; }
+        bool operator>(const row_iterator& other) const { return pos_ > other.pos_; }
+        bool operator<=(const row_iterator& other) const { return pos_ <= other.pos_; }
+        bool operator>=(const row_iterator& other) const { return pos_ >= other.pos_; }
+        friend row_iterator operator+(difference_type n, const row_iterator& it) { return it + n; }
+
+     private:
+        owner* owner_;
+        size_type pos_;
+    };
+    using iterator = row_iterator<false>;
+    using const_iterator = row_iterator<true>;
+
+ private:
+    static constexpr size_t kColumnAlign = 64;
+    std::tuple<Fields*...> columns_;
+    size_type size_;
+    size_type capacity_;
+
+    template <typename F>
+    static void for_each_field(F&& f);
+    template <typename T>
+    static T* allocate(size_type n);
+    template <typename T>
+    static void deallocate(T* p) noexcept;
+    static void release(std::tuple<Fields*...>& columns, size_type built, size_type size) noexcept;
+    void reallocate(size_type new_capacity);
+    template <typename... Args>
+    void construct_back(Args&&... args);
+
+ public:
+    soa_vector() noexcept : columns_(), size_(0), capacity_(0) {}
+    explicit soa_vector(size_type n);
+    soa_vector(const soa_vector& other);
+    soa_vector(soa_vector&& other) noexcept;
+    soa_vector& operator=(const soa_vector& other);
+    soa_vector& operator=(soa_vector&& other) noexcept;
+    ~soa_vector();
+
+    size_type size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    size_type capacity() const noexcept { return capacity_; }
+    void reserve(size_type n);
+    void shrink_to_fit();
+    void resize(size_type n);
+    void clear() noexcept;
+
+    reference operator[](size_type pos) noexcept;
+    const_reference operator[](size_type pos) const noexcept;
+    reference at(size_type pos);
+    const_reference at(size_type pos) const;
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, size_); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+    template <size_t I>
+    field_type<I>* data() noexcept { return std::get<I>(columns_); }
+    template <size_t I>
+    const field_type<I>* data() const noexcept { return std::get<I>(columns_); }
+    template <size_t I>
+    column_span<field_type<I>> column() noexcept { return {std::get<I>(columns_), size_}; }
+    template <size_t I>
+    column_span<const field_type<I>> column() const noexcept { return {std::get<I>(columns_), size_}; }
+
+    void push_back(const Fields&... values) { emplace_back(values...); }
+    void push_back(Fields&&... values) { emplace_back(std::move(values)...); }
+    // constructs every field of a new last row from the matching argument
+    template <typename... Args>
+    reference emplace_back(Args&&... args);
+    void pop_back();
+    void swap(soa_vector& other) noexcept;
+};
+}  // namespace sfleta_
+
+namespace std {
+template <typename... Refs>
+struct tuple_size<sfleta_::soa_row<Refs...>> : integral_constant<size_t, sizeof...(Refs)> {};
+template <size_t I, typename... Refs>
+struct tuple_element<I, sfleta_::soa_row<Refs...>> : tuple_element<I, tuple<Refs...>> {};
+}  // namespace std
+#include "sfleta_soa_vector.cpp"
+#endif  // SRC_sfleta_SOA_VECTOR_H_
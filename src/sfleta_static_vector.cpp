@@ -0,0 +1,187 @@
+namespace sfleta_ {
+template <typename T, size_t N, typename Overflow>
+void static_vector<T, N, Overflow>::require(size_type count) const {
+    if constexpr (Overflow::kChecked) {
+        if (count > N - this->size_) {
+            throw std::length_error("error sfleta_static_vector: capacity exceeded");
+        }
+    } else {
+        assert(count <= N - this->size_ && "static_vector capacity exceeded");
+    }
+}
+
+template <typename T, size_t N, typename Overflow>
+static_vector<T, N, Overflow>::static_vector(static_vector&& v)
+    noexcept(std::is_nothrow_move_constructible_v<T>) : static_vector() {
+    std::uninitialized_move_n(v.buffer_, v.size_, this->buffer_);
+    this->size_ = v.size_;
+    v.clear();
+}
+
+template <typename T, size_t N, typename Overflow>
+static_vector<T, N, Overflow>& static_vector<T, N, Overflow>::operator=(const static_vector& v) {
+    if (this != &v) {
+        assign(v.buffer_, v.buffer_ + v.size_);
+    }
+    return *this;
+}
+
+template <typename T, size_t N, typename Overflow>
+static_vector<T, N, Overflow>& static_vector<T, N, Overflow>::operator=(static_vector&& v)
+    noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>) {
+    if (this != &v) {
+        size_type common = std::min(this->size_, v.size_);
+        std::move(v.buffer_, v.buffer_ + common, this->buffer_);
+        if (v.size_ > common) {
+            std::uninitialized_move(v.buffer_ + common, v.buffer_ + v.size_, this->buffer_ + common);
+        } else {
+            std::destroy(this->buffer_ + common, this->buffer_ + this->size_);
+        }
+        this->size_ = v.size_;
+        v.clear();
+    }
+    return *this;
+}
+
+template <typename T, size_t N, typename Overflow>
+template <typename... Args>
+typename static_vector<T, N, Overflow>::iterator static_vector<T, N, Overflow>::emplace_at(size_type index,
+    Args&&... args) {
+    require(1);
+    return detail::emplace_in_place(this->buffer_, this->size_, N, index, std::forward<Args>(args)...);
+}
+
+template <typename T, size_t N, typename Overflow>
+template <typename... Args>
+T* static_vector<T, N, Overflow>::try_emplace_back(Args&&... args) {
+    if (this->size_ == N) {
+        return nullptr;
+    }
+    T* last = this->buffer_ + this->size_;
+    ::new (static_cast<void*>(last)) T(std::forward<Args>(args)...);
+    this->size_++;
+    return last;
+}
+
+template <typename T, size_t N, typename Overflow>
+template <typename ForwardIt>
+typename static_vector<T, N, Overflow>::iterator static_vector<T, N, Overflow>::insert_range(size_type index,
+    ForwardIt first, size_type count) {
+    if (count == 0) {
+        return this->buffer_ + index;
+    }
+    require(count);
+    return detail::insert_in_place(this->buffer_, this->size_, N, index, first, count);
+}
+
+template <typename T, size_t N, typename Overflow>
+typename static_vector<T, N, Overflow>::iterator static_vector<T, N, Overflow>::insert(iterator pos,
+    size_type count, const_reference value) {
+    T copy(value);
+    return insert_range(pos - this->buffer_, FillIterator<T>(copy, 0), count);
+}
+
+template <typename T, size_t N, typename Overflow>
+template <typename InputIt, typename>
+typename static_vector<T, N, Overflow>::iterator static_vector<T, N, Overflow>::insert(iterator pos,
+    InputIt first, InputIt last) {
+    size_type index = pos - this->buffer_;
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+        return insert_range(index, first, static_cast<size_type>(std::distance(first, last)));
+    } else {
+        return detail::insert_single_pass(*this, index, first, last);
+    }
+}
+
+template <typename T, size_t N, typename Overflow>
+void static_vector<T, N, Overflow>::assign(size_type count, const_reference value) {
+    T copy(value);
+    clear();
+    insert_range(0, FillIterator<T>(copy, 0), count);
+}
+
+template <typename T, size_t N, typename Overflow>
+template <typename InputIt, typename>
+void static_vector<T, N, Overflow>::assign(InputIt first, InputIt last) {
+    clear();
+    insert(this->buffer_, first, last);
+}
+
+template <typename T, size_t N, typename Overflow>
+void static_vector<T, N, Overflow>::resize(size_type count) {
+    if (count <= this->size_) {
+        std::destroy_n(this->buffer_ + count, this->size_ - count);
+    } else {
+        require(count - this->size_);
+        std::uninitialized_value_construct_n(this->buffer_ + this->size_, count - this->size_);
+    }
+    this->size_ = count;
+}
+
+template <typename T, size_t N, typename Overflow>
+void static_vector<T, N, Overflow>::resize(size_type count, const_reference value) {
+    if (count <= this->size_) {
+        std::destroy_n(this->buffer_ + count, this->size_ - count);
+    } else {
+        require(count - this->size_);
+        std::uninitialized_fill_n(this->buffer_ + this->size_, count - this->size_, value);
+    }
+    this->size_ = count;
+}
+
+template <typename T, size_t N, typename Overflow>
+void static_vector<T, N, Overflow>::clear() {
+    std::destroy_n(this->buffer_, this->size_);
+    this->size_ = 0;
+}
+
+template <typename T, size_t N, typename Overflow>
+typename static_vector<T, N, Overflow>::iterator static_vector<T, N, Overflow>::erase(iterator first,
+    iterator last) {
+    size_type count = last - first;
+    if (count == 0) {
+        return first;
+    }
+    T* old_end = this->buffer_ + this->size_;
+    std::move(last, old_end, first);
+    std::destroy(old_end - count, old_end);
+    this->size_ -= count;
+    return first;
+}
+
+template <typename T, size_t N, typename Overflow>
+void static_vector<T, N, Overflow>::pop_back() {
+    if (this->size_ > 0) {
+        this->size_--;
+        this->buffer_[this->size_].~T();
+    }
+}
+
+template <typename T, size_t N, typename Overflow>
+void static_vector<T, N, Overflow>::swap(static_vector& other) {
+    if (this == &other) {
+        return;
+    }
+    static_vector* shorter = this->size_ < other.size_ ? this : &other;
+    static_vector* longer = shorter == this ? &other : this;
+    size_type common = shorter->size_;
+    std::swap_ranges(shorter->buffer_, shorter->buffer_ + common, longer->buffer_);
+    std::uninitialized_move(longer->buffer_ + common, longer->buffer_ + longer->size_, shorter->buffer_ + common);
+    std::destroy(longer->buffer_ + common, longer->buffer_ + longer->size_);
+    std::swap(this->size_, other.size_);
+}
+
+template <typename T, size_t N, typename Overflow, typename Pred>
+size_t erase_if(static_vector<T, N, Overflow>& v, Pred pred) {
+    auto new_end = std::remove_if(v.begin(), v.end(), pred);
+    size_t removed = v.end() - new_end;
+    v.erase(new_end, v.end());
+    return removed;
+}
+
+template <typename T, size_t N, typename Overflow, typename U>
+size_t erase(static_vector<T, N, Overflow>& v, const U& value) {
+    return erase_if(v, [&value](const T& item) { return item == value; });
+}
+}  // namespace sfleta_
@@ -0,0 +1,95 @@
+#ifndef SRC_sfleta_STATIC_VECTOR_H_
+#define SRC_sfleta_STATIC_VECTOR_H_
+#include "sfleta_vector.h"
+namespace sfleta_ {
+// Overflow policies of static_vector: checked throws std::length_error when
+// an insertion would pass the capacity, unchecked only asserts in debug builds.
+struct overflow_checked {
+    static constexpr bool kChecked = true;
+};
+struct overflow_unchecked {
+    static constexpr bool kChecked = false;
+};
+
+// vector of at most N elements kept in inline storage; it never allocates,
+// so it is safe on paths where heap use is forbidden.
+template <typename T, size_t N, typename Overflow = overflow_checked>
+class static_vector : public VA_Container<T> {
+    static_assert(N > 0, "static_vector needs room for at least one element");
+
+ public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using size_type = size_t;
+
+ private:
+    alignas(T) unsigned char storage_[N * sizeof(T)];
+
+    T* inline_data() { return reinterpret_cast<T*>(storage_); }
+    // applies the overflow policy before count more elements are added
+    void require(size_type count) const;
+    template <typename... Args>
+    iterator emplace_at(size_type index, Args&&... args);
+    template <typename ForwardIt>
+    iterator insert_range(size_type index, ForwardIt first, size_type count);
+
+ public:
+    static_vector() noexcept { this->buffer_ = inline_data(); }
+    explicit static_vector(size_type n) : static_vector() { resize(n); }
+    static_vector(std::initializer_list<value_type> const& items) : static_vector()
+    { insert_range(0, items.begin(), items.size()); }
+    static_vector(const static_vector& v) : static_vector() { insert_range(0, v.buffer_, v.size_); }
+    static_vector(static_vector&& v) noexcept(std::is_nothrow_move_constructible_v<T>);
+    ~static_vector() { clear(); }
+    static_vector& operator=(const static_vector& v);
+    static_vector& operator=(static_vector&& v) noexcept(std::is_nothrow_move_constructible_v<T> &&
+                                                         std::is_nothrow_move_assignable_v<T>);
+
+    static constexpr size_type capacity() { return N; }
+    static constexpr size_type max_size() { return N; }
+    bool full() const { return this->size_ == N; }
+
+    void assign(size_type count, const_reference value);
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    void assign(InputIt first, InputIt last);
+    void assign(std::initializer_list<value_type> items) { assign(items.begin(), items.end()); }
+
+    void resize(size_type count);
+    void resize(size_type count, const_reference value);
+
+    void clear();
+    iterator insert(iterator pos, const_reference value) { return emplace_at(pos - this->buffer_, value); }
+    iterator insert(iterator pos, value_type&& value) { return emplace_at(pos - this->buffer_, std::move(value)); }
+    iterator insert(iterator pos, size_type count, const_reference value);
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    iterator insert(iterator pos, InputIt first, InputIt last);
+    iterator insert(iterator pos, std::initializer_list<value_type> items)
+    { return insert_range(pos - this->buffer_, items.begin(), items.size()); }
+
+    void erase(iterator pos) { erase(pos, pos + 1); }
+    iterator erase(iterator first, iterator last);
+    void push_back(const_reference value) { emplace_at(this->size_, value); }
+    void push_back(value_type&& value) { emplace_at(this->size_, std::move(value)); }
+    void pop_back();
+    void swap(static_vector& other);
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    { return emplace_at(pos - this->buffer_, std::forward<Args>(args)...); }
+    template <typename... Args>
+    reference emplace_back(Args&&... args) { return *emplace_at(this->size_, std::forward<Args>(args)...); }
+    // appends unless the vector is full, whatever the overflow policy; nullptr when full
+    template <typename... Args>
+    T* try_emplace_back(Args&&... args);
+};
+
+template <typename T, size_t N, typename Overflow, typename Pred>
+size_t erase_if(static_vector<T, N, Overflow>& v, Pred pred);
+template <typename T, size_t N, typename Overflow, typename U>
+size_t erase(static_vector<T, N, Overflow>& v, const U& value);
+}  // namespace sfleta_
+#include "sfleta_static_vector.cpp"
+#endif  // SRC_sfleta_STATIC_VECTOR_H_
@@ -0,0 +1,159 @@
+namespace sfleta_ {
+namespace detail {
+struct worker_slot {
+    const thread_pool* pool = nullptr;
+    size_t index = 0;
+};
+
+inline worker_slot& current_worker() noexcept {
+    static thread_local worker_slot slot;
+    return slot;
+}
+}  // namespace detail
+
+inline thread_pool::thread_pool(size_t threads) : pending_(0), next_queue_(0), stop_(false) {
+    threads = std::max<size_t>(threads, 1);
+    for (size_t i = 0; i < threads; ++i) queues_.push_back(std::make_unique<worker_queue>());
+    try {
+        for (size_t i = 0; i < threads; ++i) threads_.emplace_back([this, i] { worker_loop(i); });
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& thread : threads_) thread.join();
+        throw;
+    }
+}
+
+inline thread_pool::~thread_pool() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) thread.join();
+}
+
+inline thread_pool& thread_pool::global() {
+    static thread_pool pool;
+    return pool;
+}
+
+inline size_t thread_pool::home_queue() const noexcept {
+    const detail::worker_slot& slot = detail::current_worker();
+    return slot.pool == this ? slot.index : queues_.size();
+}
+
+inline void thread_pool::submit(std::function<void()> task) {
+    size_t index = home_queue();
+    if (index == queues_.size()) index = next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    {
+        // counted under the queue lock, so pop_task never takes pending_ below zero
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+        pending_.fetch_add(1, std::memory_order_release);
+    }
+    // pass through the sleep mutex so a worker checking pending_ cannot miss the wake up
+    { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+    wake_.notify_one();
+}
+
+inline bool thread_pool::pop_task(size_t home, std::function<void()>& task) {
+    if (home < queues_.size()) {
+        worker_queue& own = *queues_[home];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    size_t start = home < queues_.size() ? home + 1 : 0;
+    for (size_t k = 0; k < queues_.size(); ++k) {
+        worker_queue& victim = *queues_[(start + k) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool thread_pool::run_one() {
+    std::function<void()> task;
+    if (!pop_task(home_queue(), task)) return false;
+    task();
+    return true;
+}
+
+inline void thread_pool::worker_loop(size_t index) {
+    detail::current_worker() = detail::worker_slot{this, index};
+    std::function<void()> task;
+    while (true) {
+        if (pop_task(index, task)) {
+            task();
+            task = nullptr;
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_.wait(lock, [this] { return stop_ || pending_.load(std::memory_order_acquire) > 0; });
+        if (stop_ && pending_.load(std::memory_order_acquire) == 0) return;
+    }
+}
+
+template <typename F>
+void task_group::run(F&& f) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    try {
+        pool_.submit([this, f = std::forward<F>(f)]() mutable {
+            try {
+                f();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex_);
+                if (!error_) error_ = std::current_exception();
+            }
+            // last touch of the group, join() returns only once the lock is released
+            std::lock_guard<std::mutex> lock(done_mutex_);
+            if (pending_.fetch_sub(1, std::memory_order_release) == 1) done_.notify_all();
+        });
+    } catch (...) {
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        throw;
+    }
+    {
+        std::lock_guard<std::mutex> lock(done_mutex_);
+        spawned_.fetch_add(1, std::memory_order_relaxed);
+    }
+    done_.notify_all();
+}
+
+inline void task_group::join() noexcept {
+    while (pending_.load(std::memory_order_acquire) != 0) {
+        // read before looking for work, so a task queued after run_one() came back empty wakes us
+        size_t seen = spawned_.load(std::memory_order_relaxed);
+        if (pool_.run_one()) continue;
+        std::unique_lock<std::mutex> lock(done_mutex_);
+        done_.wait(lock, [this, seen] {
+            return pending_.load(std::memory_order_acquire) == 0 || spawned_.load(std::memory_order_relaxed) != seen;
+        });
+    }
+    // the last task may still hold the lock it counted down under
+    std::lock_guard<std::mutex> lock(done_mutex_);
+}
+
+inline void task_group::wait() {
+    join();
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        std::swap(error, error_);
+    }
+    if (error) std::rethrow_exception(error);
+}
+}  // namespace sfleta_
@@ -0,0 +1,81 @@
+#ifndef SRC_sfleta_THREAD_POOL_H_
+#define SRC_sfleta_THREAD_POOL_H_
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+namespace sfleta_ {
+// Work-stealing pool: every worker owns a task deque, runs its own tasks
+// newest first and steals the oldest task of another worker when it runs dry.
+// Submitted tasks must not throw, task_group wraps them to carry exceptions.
+class thread_pool {
+ public:
+    explicit thread_pool(size_t threads = std::thread::hardware_concurrency());
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+    // runs the tasks still queued, then joins the workers
+    ~thread_pool();
+
+    size_t size() const noexcept { return threads_.size(); }
+    void submit(std::function<void()> task);
+    // runs one queued task on the calling thread, false if there was none
+    bool run_one();
+
+    // shared pool used by the parallel algorithms
+    static thread_pool& global();
+
+ private:
+    struct worker_queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<worker_queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<size_t> pending_;
+    std::atomic<size_t> next_queue_;
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stop_;
+
+    // index of the calling worker's queue, or queues_.size() outside the pool
+    size_t home_queue() const noexcept;
+    bool pop_task(size_t home, std::function<void()>& task);
+    void worker_loop(size_t index);
+};
+
+// Fork/join scope over a pool. wait() runs queued tasks while it blocks, so
+// groups can nest inside pool tasks, and rethrows the first task exception.
+class task_group {
+ public:
+    explicit task_group(thread_pool& pool) : pool_(pool), pending_(0), spawned_(0) {}
+    task_group(const task_group&) = delete;
+    task_group& operator=(const task_group&) = delete;
+    ~task_group() { join(); }
+
+    template <typename F>
+    void run(F&& f);
+    void wait();
+
+ private:
+    thread_pool& pool_;
+    std::atomic<size_t> pending_;
+    // counts run() calls, so a sleeping join() notices new tasks it could help with
+    std::atomic<size_t> spawned_;
+    std::mutex done_mutex_;
+    std::condition_variable done_;
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+
+    void join() noexcept;
+};
+}  // namespace sfleta_
+#include "sfleta_thread_pool.cpp"
+#endif  // SRC_sfleta_THREAD_POOL_H_
@@ -1,44 +1,160 @@
 namespace sfleta_ {
-template <typename T>
-vector<T>::vector() {
-    this->buffer_ = new T[1]{};
+namespace detail {
+template <typename T, typename... Args>
+T* emplace_in_place(T* buffer, size_t& size, size_t capacity, size_t index, Args&&... args) {
+    assert(size < capacity && index <= size);
+    (void)capacity;
+    T* last = buffer + size;
+    if (index == size) {
+        ::new (static_cast<void*>(last)) T(std::forward<Args>(args)...);
+    } else {
+        // args may refer into the elements that are about to shift
+        T value(std::forward<Args>(args)...);
+        ::new (static_cast<void*>(last)) T(std::move(*(last - 1)));
+        std::move_backward(buffer + index, last - 1, last);
+        buffer[index] = std::move(value);
+    }
+    size++;
+    return buffer + index;
+}
+
+template <typename T, typename ForwardIt>
+T* insert_in_place(T* buffer, size_t& size, size_t capacity, size_t index, ForwardIt first, size_t count) {
+    assert(count <= capacity - size && index <= size);
+    (void)capacity;
+    T* pos = buffer + index;
+    T* old_end = buffer + size;
+    size_t elems_after = size - index;
+    if (elems_after > count) {
+        std::uninitialized_move(old_end - count, old_end, old_end);
+        size += count;
+        std::move_backward(pos, old_end - count, old_end);
+        std::copy_n(first, count, pos);
+    } else {
+        ForwardIt mid = first;
+        std::advance(mid, elems_after);
+        std::uninitialized_copy_n(mid, count - elems_after, old_end);
+        size += count - elems_after;
+        std::uninitialized_move(pos, old_end, buffer + size);
+        size += elems_after;
+        std::copy(first, mid, pos);
+    }
+    return pos;
+}
+
+template <typename Vector, typename InputIt>
+typename Vector::iterator insert_single_pass(Vector& v, size_t index, InputIt first, InputIt last) {
+    size_t old_size = v.size();
+    try {
+        for (; first != last; ++first) {
+            v.emplace_back(*first);
+        }
+    } catch (...) {
+        // drop the partly appended input
+        v.erase(v.data() + old_size, v.data() + v.size());
+        throw;
+    }
+    std::rotate(v.data() + index, v.data() + old_size, v.data() + v.size());
+    return v.data() + index;
+}
+}  // namespace detail
+
+template <typename T, typename Growth, size_t Align, typename Storage>
+T* vector<T, Growth, Align, Storage>::allocate(size_type n) {
+    if (n == 0) {
+        return nullptr;
+    }
+    if constexpr (!kDefaultStorage) {
+        return static_cast<T*>(Storage::allocate(n * sizeof(T), kAlign));
+    } else if constexpr (kUseMalloc) {
+        void* p = std::malloc(n * sizeof(T));
+        if (p == nullptr) throw std::bad_alloc();
+        return static_cast<T*>(p);
+    } else if constexpr (kAlign > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(kAlign)));
+    } else {
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+}
+
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::deallocate(T* p, size_type n) {
+    if constexpr (!kDefaultStorage) {
+        if (p) Storage::deallocate(p, n * sizeof(T), kAlign);
+    } else if constexpr (kUseMalloc) {
+        std::free(p);
+    } else if constexpr (kAlign > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        ::operator delete(p, std::align_val_t(kAlign));
+    } else {
+        ::operator delete(p);
+    }
+}
+
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::transfer(T* first, size_type n, T* dest) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (n) std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), n * sizeof(T));
+    } else if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+        std::uninitialized_move_n(first, n, dest);
+    } else {
+        std::uninitialized_copy_n(first, n, dest);
+    }
+}
+
+template <typename T, typename Growth, size_t Align, typename Storage>
+vector<T, Growth, Align, Storage>::vector() noexcept {
     this->capacity_ = 0;
-    this->size_ = 0;
 }
 
-template <typename T>
-vector<T>::vector(size_type n) {
+template <typename T, typename Growth, size_t Align, typename Storage>
+vector<T, Growth, Align, Storage>::vector(size_type n) {
     if (n > this->max_size()) {
         throw std::length_error("try make vector larger than max_size()");
     }
 
+    this->buffer_ = allocate(n);
+    try {
+        std::uninitialized_value_construct_n(this->buffer_, n);
+    } catch (...) {
+        deallocate(this->buffer_, n);
+        throw;
+    }
     this->capacity_ = n;
     this->size_ = n;
-    this->buffer_ = new T[capacity_]{};
 }
 
-template <class T>
-vector<T>::vector(std::initializer_list<value_type> const& items)
-    : vector(items.size()) {
-    this->size_ = 0;
-    for (auto& item : items) {
-        this->buffer_[this->size_] = item;
-        this->size_++;
+template <typename T, typename Growth, size_t Align, typename Storage>
+vector<T, Growth, Align, Storage>::vector(std::initializer_list<value_type> const& items) {
+    this->buffer_ = allocate(items.size());
+    try {
+        std::uninitialized_copy(items.begin(), items.end(), this->buffer_);
+    } catch (...) {
+        deallocate(this->buffer_, items.size());
+        throw;
     }
+    this->capacity_ = items.size();
+    this->size_ = items.size();
 }
 
-template <typename T>
-vector<T>::vector(const vector& v) {
+template <typename T, typename Growth, size_t Align, typename Storage>
+vector<T, Growth, Align, Storage>::vector(const vector& v) {
+    this->buffer_ = allocate(v.capacity_);
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (v.size_) std::memcpy(static_cast<void*>(this->buffer_), static_cast<const void*>(v.buffer_), v.size_ * sizeof(T));
+    } else {
+        try {
+            std::uninitialized_copy_n(v.buffer_, v.size_, this->buffer_);
+        } catch (...) {
+            deallocate(this->buffer_, v.capacity_);
+            throw;
+        }
+    }
     this->capacity_ = v.capacity_;
     this->size_ = v.size_;
-    this->buffer_ = new T[this->capacity_]{};
-    for (size_type i = 0; i < v.size_; ++i) {
-        this->buffer_[i] = v.buffer_[i];
-    }
 }
 
-template <typename T>
-vector<T>::vector(vector&& v) {
+template <typename T, typename Growth, size_t Align, typename Storage>
+vector<T, Growth, Align, Storage>::vector(vector&& v) noexcept {
     this->buffer_ = v.buffer_;
     this->capacity_ = v.capacity_;
     this->size_ = v.size_;
@@ -48,8 +164,8 @@ vector<T>::vector(vector&& v) {
     v.size_ = 0;
 }
 
-template <class T>
-vector<T>& vector<T>::operator=(vector&& v) {
+template <typename T, typename Growth, size_t Align, typename Storage>
+vector<T, Growth, Align, Storage>& vector<T, Growth, Align, Storage>::operator=(vector&& v) noexcept {
     if (this == &v) {
         return *this;
     }
@@ -65,133 +181,361 @@ vector<T>& vector<T>::operator=(vector&& v) {
     return *this;
 }
 
-template <typename T>
-vector<T>::~vector() {
+template <typename T, typename Growth, size_t Align, typename Storage>
+vector<T, Growth, Align, Storage>::~vector() {
     remove_vector();
 }
 
-template <typename T>
-void vector<T>::remove_vector() {
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::remove_vector() {
     if (this->buffer_ != nullptr) {
-        delete[] this->buffer_;
+        std::destroy_n(this->buffer_, this->size_);
+        deallocate(this->buffer_, this->capacity_);
         this->buffer_ = nullptr;
     }
     capacity_ = 0;
     this->size_ = 0;
 }
 
-template <typename T>
-void vector<T>::resize(vector<T>::size_type size) {
-    vector<value_type> newVector(size);
-    for (size_type i = 0; i < this->size_; ++i) {
-        newVector.buffer_[i] = this->buffer_[i];
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::reallocate(vector<T, Growth, Align, Storage>::size_type size) {
+    if constexpr (kUseMalloc) {
+        if (size == 0) {
+            std::free(this->buffer_);
+            this->buffer_ = nullptr;
+        } else {
+            void* p = std::realloc(static_cast<void*>(this->buffer_), size * sizeof(T));
+            if (p == nullptr) throw std::bad_alloc();
+            this->buffer_ = static_cast<T*>(p);
+        }
+    } else if constexpr (kRelocatable) {
+        T* new_buffer = allocate(size);
+        if (this->size_) std::memcpy(static_cast<void*>(new_buffer), static_cast<void*>(this->buffer_), this->size_ * sizeof(T));
+        deallocate(this->buffer_, this->capacity_);
+        this->buffer_ = new_buffer;
+    } else {
+        T* new_buffer = allocate(size);
+        try {
+            transfer(this->buffer_, this->size_, new_buffer);
+        } catch (...) {
+            deallocate(new_buffer, size);
+            throw;
+        }
+        std::destroy_n(this->buffer_, this->size_);
+        deallocate(this->buffer_, this->capacity_);
+        this->buffer_ = new_buffer;
     }
-
-    delete[] this->buffer_;
-    this->buffer_ = newVector.buffer_;
-    newVector.buffer_ = nullptr;
-
-    this->capacity_ = newVector.capacity_;
+    this->capacity_ = size;
 }
 
-template <typename T>
-void vector<T>::reserve(vector<T>::size_type size) {
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::reserve(vector<T, Growth, Align, Storage>::size_type size) {
     if (size > this->max_size()) {
         throw std::length_error("try make vector larger than max_size()");
     }
 
     if (size > capacity_) {
-        resize(size);
+        reallocate(size);
     }
 }
 
-template <typename T>
-void vector<T>::shrink_to_fit() {
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::shrink_to_fit() {
     if (this->size_ < capacity_) {
-        resize(this->size_);
+        reallocate(this->size_);
     }
 }
 
-template <typename T>
-void vector<T>::clear() {
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::clear() {
+    std::destroy_n(this->buffer_, this->size_);
     this->size_ = 0;
 }
 
+template <typename T, typename Growth, size_t Align, typename Storage>
+template <typename... Args>
+typename vector<T, Growth, Align, Storage>::iterator vector<T, Growth, Align, Storage>::emplace_at(size_type index, Args&&... args) {
+    if constexpr (kRelocatable) {
+        if (index == this->size_ && this->size_ < capacity_) {
+            ::new (static_cast<void*>(this->buffer_ + index)) T(std::forward<Args>(args)...);
+        } else {
+            // args may refer into the buffer that is about to move or shift
+            T value(std::forward<Args>(args)...);
+            if (this->size_ == capacity_) {
+                reallocate(next_capacity(this->size_ + 1));
+            }
+            T* gap = this->buffer_ + index;
+            if (index < this->size_) {
+                std::memmove(static_cast<void*>(gap + 1), static_cast<void*>(gap), (this->size_ - index) * sizeof(T));
+            }
+            ::new (static_cast<void*>(gap)) T(std::move(value));
+        }
+    } else if (this->size_ == capacity_) {
+        // build the new element first, args may refer into the old buffer
+        size_type new_capacity = next_capacity(this->size_ + 1);
+        T* new_buffer = allocate(new_capacity);
+        try {
+            ::new (static_cast<void*>(new_buffer + index)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(new_buffer, new_capacity);
+            throw;
+        }
+        try {
+            transfer(this->buffer_, index, new_buffer);
+            try {
+                transfer(this->buffer_ + index, this->size_ - index, new_buffer + index + 1);
+            } catch (...) {
+                std::destroy_n(new_buffer, index);
+                throw;
+            }
+        } catch (...) {
+            new_buffer[index].~T();
+            deallocate(new_buffer, new_capacity);
+            throw;
+        }
+
+        std::destroy_n(this->buffer_, this->size_);
+        deallocate(this->buffer_, this->capacity_);
+        this->buffer_ = new_buffer;
+        this->capacity_ = new_capacity;
+    } else {
+        return detail::emplace_in_place(this->buffer_, this->size_, capacity_, index, std::forward<Args>(args)...);
+    }
+    this->size_++;
+    return this->buffer_ + index;
+}
 
-template <typename T>
-typename vector<T>::iterator vector<T>::insert(iterator pos,
+template <typename T, typename Growth, size_t Align, typename Storage>
+typename vector<T, Growth, Align, Storage>::iterator vector<T, Growth, Align, Storage>::insert(iterator pos,
     const_reference value) {
-    size_type pos_index = pos - this->buffer_;
-    if (this->size_ == capacity_) {
-        if (capacity_ == 0) capacity_++;
-        reserve(capacity_ * 2);
+    return emplace_at(pos - this->buffer_, value);
+}
+
+template <typename T, typename Growth, size_t Align, typename Storage>
+typename vector<T, Growth, Align, Storage>::iterator vector<T, Growth, Align, Storage>::insert(iterator pos,
+    value_type&& value) {
+    return emplace_at(pos - this->buffer_, std::move(value));
+}
+
+template <typename T, typename Growth, size_t Align, typename Storage>
+template <typename ForwardIt>
+typename vector<T, Growth, Align, Storage>::iterator vector<T, Growth, Align, Storage>::insert_range(size_type index,
+    ForwardIt first, size_type count) {
+    if (count == 0) {
+        return this->buffer_ + index;
+    }
+    if (count > this->max_size() - this->size_) {
+        throw std::length_error("try make vector larger than max_size()");
     }
 
-    for (size_type i = this->size_; i > pos_index; --i) {
-        this->buffer_[i] = this->buffer_[i - 1];
-        if (i == pos_index) {
-            this->buffer_[i] = value;
+    if constexpr (kRelocatable) {
+        if (this->size_ + count > capacity_) {
+            reallocate(next_capacity(this->size_ + count));
+        }
+        T* gap = this->buffer_ + index;
+        size_type tail = this->size_ - index;
+        if (tail) std::memmove(static_cast<void*>(gap + count), static_cast<void*>(gap), tail * sizeof(T));
+        try {
+            std::uninitialized_copy_n(first, count, gap);
+        } catch (...) {
+            if (tail) std::memmove(static_cast<void*>(gap), static_cast<void*>(gap + count), tail * sizeof(T));
+            throw;
+        }
+        this->size_ += count;
+    } else if (this->size_ + count > capacity_) {
+        size_type new_capacity = next_capacity(this->size_ + count);
+        T* new_buffer = allocate(new_capacity);
+        try {
+            std::uninitialized_copy_n(first, count, new_buffer + index);
+        } catch (...) {
+            deallocate(new_buffer, new_capacity);
+            throw;
         }
+        try {
+            transfer(this->buffer_, index, new_buffer);
+            try {
+                transfer(this->buffer_ + index, this->size_ - index, new_buffer + index + count);
+            } catch (...) {
+                std::destroy_n(new_buffer, index);
+                throw;
+            }
+        } catch (...) {
+            std::destroy_n(new_buffer + index, count);
+            deallocate(new_buffer, new_capacity);
+            throw;
+        }
+
+        std::destroy_n(this->buffer_, this->size_);
+        deallocate(this->buffer_, this->capacity_);
+        this->buffer_ = new_buffer;
+        this->capacity_ = new_capacity;
+        this->size_ += count;
+    } else {
+        return detail::insert_in_place(this->buffer_, this->size_, capacity_, index, first, count);
     }
+    return this->buffer_ + index;
+}
 
-    this->size_++;
-    this->buffer_[pos_index] = value;
-    pos = this->buffer_ + pos_index;
-    return pos;
+template <typename T, typename Growth, size_t Align, typename Storage>
+typename vector<T, Growth, Align, Storage>::iterator vector<T, Growth, Align, Storage>::insert(iterator pos,
+    size_type count, const_reference value) {
+    // value may live inside the part of the buffer that is about to move
+    T copy(value);
+    return insert_range(pos - this->buffer_, FillIterator<T>(copy, 0), count);
 }
 
-template <typename T>
-void vector<T>::erase(const iterator pos) {
+template <typename T, typename Growth, size_t Align, typename Storage>
+template <typename InputIt, typename>
+typename vector<T, Growth, Align, Storage>::iterator vector<T, Growth, Align, Storage>::insert(iterator pos,
+    InputIt first, InputIt last) {
+    size_type index = pos - this->buffer_;
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+        return insert_range(index, first, static_cast<size_type>(std::distance(first, last)));
+    } else {
+        return detail::insert_single_pass(*this, index, first, last);
+    }
+}
+
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::assign(size_type count, const_reference value) {
+    T copy(value);
+    clear();
+    if (count > capacity_) {
+        reserve(count);
+    }
+    std::uninitialized_fill_n(this->buffer_, count, copy);
+    this->size_ = count;
+}
+
+template <typename T, typename Growth, size_t Align, typename Storage>
+template <typename InputIt, typename>
+void vector<T, Growth, Align, Storage>::assign(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    clear();
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+        size_type count = std::distance(first, last);
+        if (count > capacity_) {
+            reserve(count);
+        }
+        std::uninitialized_copy_n(first, count, this->buffer_);
+        this->size_ = count;
+    } else {
+        for (; first != last; ++first) {
+            emplace_at(this->size_, *first);
+        }
+    }
+}
+
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::resize(size_type count) {
+    if (count <= this->size_) {
+        std::destroy_n(this->buffer_ + count, this->size_ - count);
+    } else {
+        if (count > capacity_) {
+            reserve(next_capacity(count));
+        }
+        std::uninitialized_value_construct_n(this->buffer_ + this->size_, count - this->size_);
+    }
+    this->size_ = count;
+}
+
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::resize(size_type count, const_reference value) {
+    if (count <= this->size_) {
+        std::destroy_n(this->buffer_ + count, this->size_ - count);
+    } else {
+        T copy(value);
+        if (count > capacity_) {
+            reserve(next_capacity(count));
+        }
+        std::uninitialized_fill_n(this->buffer_ + this->size_, count - this->size_, copy);
+    }
+    this->size_ = count;
+}
+
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::erase(const iterator pos) {
     if (this->size_ > 0) {
-        size_type pos_index = pos - this->buffer_;
-        for (size_type i = pos_index; i < this->size_ - 1; ++i) {
-            this->buffer_[i] = this->buffer_[i + 1];
+        if constexpr (kRelocatable) {
+            pos->~T();
+            this->size_--;
+            std::memmove(static_cast<void*>(pos), static_cast<void*>(pos + 1),
+                (this->buffer_ + this->size_ - pos) * sizeof(T));
+        } else {
+            std::move(pos + 1, this->buffer_ + this->size_, pos);
+            this->size_--;
+            this->buffer_[this->size_].~T();
         }
-        this->size_--;
     }
 }
 
-template <typename T>
-void vector<T>::push_back(const_reference value) {
-    if (this->size_ == 0 && this->capacity_ == 0) {
-        capacity_++;
+template <typename T, typename Growth, size_t Align, typename Storage>
+typename vector<T, Growth, Align, Storage>::iterator vector<T, Growth, Align, Storage>::erase(iterator first, iterator last) {
+    size_type count = last - first;
+    if (count == 0) {
+        return first;
     }
-    if (this->size_ == capacity_) {
-        reserve(capacity_ * 2);
+    T* old_end = this->buffer_ + this->size_;
+    if constexpr (kRelocatable) {
+        std::destroy(first, last);
+        std::memmove(static_cast<void*>(first), static_cast<void*>(last), (old_end - last) * sizeof(T));
+    } else {
+        std::move(last, old_end, first);
+        std::destroy(old_end - count, old_end);
     }
-    this->buffer_[this->size_] = value;
-    this->size_++;
+    this->size_ -= count;
+    return first;
+}
+
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::push_back(const_reference value) {
+    emplace_at(this->size_, value);
+}
+
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::push_back(value_type&& value) {
+    emplace_at(this->size_, std::move(value));
 }
 
-template <typename T>
-void vector<T>::pop_back() {
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::pop_back() {
     if (this->size_ > 0) {
         this->size_--;
+        this->buffer_[this->size_].~T();
     }
 }
 
-template <typename T>
-void vector<T>::swap(vector& other) {
+template <typename T, typename Growth, size_t Align, typename Storage>
+void vector<T, Growth, Align, Storage>::swap(vector& other) {
     std::swap(this->buffer_, other.buffer_);
     std::swap(this->capacity_, other.capacity_);
     std::swap(this->size_, other.size_);
 }
 
-template <typename T>
+template <typename T, typename Growth, size_t Align, typename Storage>
 template <typename... Args>
-typename vector<T>::iterator vector<T>::emplace(const_iterator pos,
+typename vector<T, Growth, Align, Storage>::iterator vector<T, Growth, Align, Storage>::emplace(const_iterator pos,
     Args&&... args) {
-    iterator it = (iterator)pos;
-    for (auto value : { args... }) {
-        it = insert(it, value);
-        ++it;
-    }
-    return --it;
+    return emplace_at(pos - this->buffer_, std::forward<Args>(args)...);
 }
 
-template <typename T>
+template <typename T, typename Growth, size_t Align, typename Storage>
 template <typename... Args>
-void vector<T>::emplace_back(Args&&... args) {
-    emplace(this->buffer_ + this->size_, args...);
+typename vector<T, Growth, Align, Storage>::reference vector<T, Growth, Align, Storage>::emplace_back(Args&&... args) {
+    return *emplace_at(this->size_, std::forward<Args>(args)...);
+}
+
+template <typename T, typename Growth, size_t Align, typename Storage, typename Pred>
+size_t erase_if(vector<T, Growth, Align, Storage>& v, Pred pred) {
+    auto new_end = std::remove_if(v.begin(), v.end(), pred);
+    size_t removed = v.end() - new_end;
+    v.erase(new_end, v.end());
+    return removed;
+}
+
+template <typename T, typename Growth, size_t Align, typename Storage, typename U>
+size_t erase(vector<T, Growth, Align, Storage>& v, const U& value) {
+    return erase_if(v, [&value](const T& item) { return item == value; });
 }
 }  // namespace sfleta_
@@ -1,9 +1,113 @@
 #ifndef SRC_sfleta_VECTOR_H_
 #define SRC_sfleta_VECTOR_H_
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <new>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
 #include "sfleta_VA_Container.h"
 namespace sfleta_ {
+// Types whose objects may be moved to another address with memcpy, leaving
+// the source storage dead without running its destructor. Specialize for
+// own types (e.g. classes holding only owning pointers) to enable the fast path.
 template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type {};
+
+// Growth policies decide the capacity of the next reallocation: next() gets
+// the current capacity and the size that must fit, and returns at least that.
+template <size_t Num, size_t Den>
+struct growth_factor {
+    static_assert(Num > Den && Den > 0, "growth factor must be greater than 1");
+    static size_t next(size_t capacity, size_t required) {
+        size_t grown = std::numeric_limits<size_t>::max();
+        if (capacity / Den < grown / Num) {
+            grown = capacity / Den * Num + capacity % Den * Num / Den;
+        }
+        return grown > required ? grown : required;
+    }
+};
+
+using growth_double = growth_factor<2, 1>;
+using growth_golden = growth_factor<3, 2>;
+
+// grows by a fixed number of elements
+template <size_t Chunk>
+struct growth_chunk {
+    static_assert(Chunk > 0, "growth chunk must not be empty");
+    static size_t next(size_t capacity, size_t required) {
+        size_t grown = capacity + Chunk;
+        return grown > required ? grown : required;
+    }
+};
+
+// follows Base but never reserves more than MaxExtra elements beyond what is required
+template <typename Base, size_t MaxExtra>
+struct growth_capped {
+    static size_t next(size_t capacity, size_t required) {
+        size_t grown = Base::next(capacity, required);
+        return grown - required > MaxExtra ? required + MaxExtra : grown;
+    }
+};
+
+// Storage policies supply the element buffer of a vector through
+// static void* allocate(size_t bytes, size_t align) and
+// static void deallocate(void* p, size_t bytes, size_t align).
+// default_storage keeps the built-in malloc/realloc and operator new paths.
+struct default_storage {};
+
+// Forward iterator yielding the same value at every position, for fill inserts.
+template <typename T>
+class FillIterator {
+ public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+    FillIterator(const T& value, size_t pos) : value_(&value), pos_(pos) {}
+    reference operator*() const { return *value_; }
+    FillIterator& operator++() { ++pos_; return *this; }
+    FillIterator operator++(int) { FillIterator tmp(*this); ++pos_; return tmp; }
+    bool operator==(const FillIterator& other) const { return pos_ == other.pos_; }
+    bool operator!=(const FillIterator& other) const { return pos_ != other.pos_; }
+
+ private:
+    const T* value_;
+    size_t pos_;
+};
+
+// Insertion steps shared by vector, small_vector and static_vector. buffer
+// holds size live elements followed by raw storage up to capacity; the
+// in-place steps need the room for the new elements to be there already.
+namespace detail {
+// constructs one element from args before index, shifting the tail up by one
+template <typename T, typename... Args>
+T* emplace_in_place(T* buffer, size_t& size, size_t capacity, size_t index, Args&&... args);
+// copies count elements from first before index with a single shift of the tail
+template <typename T, typename ForwardIt>
+T* insert_in_place(T* buffer, size_t& size, size_t capacity, size_t index, ForwardIt first, size_t count);
+// inserts a single pass range before index: appends through emplace_back, then
+// rotates the new elements into place; an exception leaves v unchanged
+template <typename Vector, typename InputIt>
+typename Vector::iterator insert_single_pass(Vector& v, size_t index, InputIt first, InputIt last);
+}  // namespace detail
+
+// Align raises the alignment of the element buffer above alignof(T), e.g. to
+// 32 or 64 bytes for SIMD loads; it holds across every reallocation.
+template <typename T, typename Growth = growth_double, size_t Align = alignof(T),
+          typename Storage = default_storage>
 class vector : public VA_Container<T> {
+    static_assert(Align > 0 && (Align & (Align - 1)) == 0, "vector alignment must be a power of two");
+
  public:
     using value_type = T;
     using reference = T&;
@@ -13,36 +117,85 @@ class vector : public VA_Container<T> {
     using size_type = size_t;
 
  private:
-    unsigned int capacity_;
+    size_type capacity_;
     void remove_vector();
-    void resize(size_type size);
+    void reallocate(size_type size);
+    size_type next_capacity(size_type required) const { return Growth::next(capacity_, required); }
+
+    // buffer_[0, size_) holds live objects, buffer_[size_, capacity_) is raw storage
+    static constexpr bool kRelocatable = is_trivially_relocatable<T>::value;
+    static constexpr size_type kAlign = Align > alignof(T) ? Align : alignof(T);
+    static constexpr bool kDefaultStorage = std::is_same_v<Storage, default_storage>;
+    // relocatable types live in malloc memory so growth can use realloc
+    static constexpr bool kUseMalloc = kDefaultStorage && kRelocatable && kAlign <= alignof(std::max_align_t);
+    static T* allocate(size_type n);
+    // n is the capacity p was allocated with
+    static void deallocate(T* p, size_type n);
+    // constructs n objects at raw dest from first, leaves the sources alive
+    static void transfer(T* first, size_type n, T* dest);
+    template <typename... Args>
+    iterator emplace_at(size_type index, Args&&... args);
+    // inserts count elements read from first before index, with one shift
+    template <typename ForwardIt>
+    iterator insert_range(size_type index, ForwardIt first, size_type count);
 
  public:
-    vector();
+    vector() noexcept;
     explicit vector(size_type n);
     explicit vector(std::initializer_list<value_type> const& items);
     vector(const vector& v);
-    vector(vector&& v);
+    vector(vector&& v) noexcept;
     ~vector();
-    vector<T>& operator=(vector&& v);
+    vector& operator=(vector&& v) noexcept;
+
+    void assign(size_type count, const_reference value);
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    void assign(InputIt first, InputIt last);
+    void assign(std::initializer_list<value_type> items) { assign(items.begin(), items.end()); }
 
     void reserve(size_type size);
     size_type capacity() const { return capacity_; }
+    static constexpr size_type alignment() noexcept { return kAlign; }
+    // data() with the buffer alignment made known to the compiler
+    T* aligned_data() const noexcept {
+        return static_cast<T*>(__builtin_assume_aligned(this->buffer_, kAlign));
+    }
     void shrink_to_fit();
+    void resize(size_type count);
+    void resize(size_type count, const_reference value);
 
     void clear();
     iterator insert(iterator pos, const_reference value);
+    iterator insert(iterator pos, value_type&& value);
+    iterator insert(iterator pos, size_type count, const_reference value);
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    iterator insert(iterator pos, InputIt first, InputIt last);
+    iterator insert(iterator pos, std::initializer_list<value_type> items)
+    { return insert(pos, items.begin(), items.end()); }
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+    void append(InputIt first, InputIt last) { insert(this->buffer_ + this->size_, first, last); }
 
     void erase(iterator pos);
+    iterator erase(iterator first, iterator last);
     void push_back(const_reference value);
+    void push_back(value_type&& value);
     void pop_back();
     void swap(vector& other);
 
     template <typename... Args>
     iterator emplace(const_iterator pos, Args&&... args);
     template <typename... Args>
-    void emplace_back(Args&&... args);
+    reference emplace_back(Args&&... args);
 };
+
+template <typename T, size_t Align = 64, typename Growth = growth_double>
+using aligned_vector = vector<T, Growth, Align>;
+
+// Removes every element matching pred in one compacting pass, returns how many were removed.
+template <typename T, typename Growth, size_t Align, typename Storage, typename Pred>
+size_t erase_if(vector<T, Growth, Align, Storage>& v, Pred pred);
+template <typename T, typename Growth, size_t Align, typename Storage, typename U>
+size_t erase(vector<T, Growth, Align, Storage>& v, const U& value);
 }  // namespace sfleta_
 #include "sfleta_vector.cpp"
 #endif  // SRC_sfleta_VECTOR_H_
@@ -2,13 +2,23 @@
 #include "sfleta_containers.h"
 #include "sfleta_containersplus.h"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
+#include <deque>
+#include <fstream>
 #include <list>
 #include <queue>
+#include <sstream>
 #include <stack>
 
+#include <sys/wait.h>
+
 bool isEqual(double src1, double src2) {
     if (fabs(src1 - src2) < 1e-6) {
         return true;
@@ -502,7 +512,9 @@ TEST(vector_modifiers, swap2) {
 
 TEST(vector_modifiers, emplace) {
     sfleta_::vector<double> v1{ 1, 5 };
-    v1.emplace((v1.begin() + 1), 2.0, 3.0, 4.0);
+    v1.emplace(v1.begin() + 1, 2.0);
+    v1.emplace(v1.begin() + 2, 3.0);
+    v1.emplace(v1.begin() + 3, 4.0);
 
     std::vector<double> v2{ 1, 5 };
     v2.emplace((v2.begin() + 1), 2.0);
@@ -515,7 +527,9 @@ TEST(vector_modifiers, emplace) {
 
 TEST(vector_modifiers, emplace2) {
     sfleta_::vector<double> v1{};
-    v1.emplace((v1.begin()), 2.0, 3.0, 4.0);
+    v1.emplace(v1.begin(), 2.0);
+    v1.emplace(v1.begin() + 1, 3.0);
+    v1.emplace(v1.begin() + 2, 4.0);
 
     std::vector<double> v2{};
     v2.emplace((v2.begin()), 2.0);
@@ -528,7 +542,9 @@ TEST(vector_modifiers, emplace2) {
 
 TEST(vector_modifiers, emplace3) {
     sfleta_::vector<double> v1{ 1, 2 };
-    v1.emplace((v1.end()), 3.0, 4.0, 5.0);
+    v1.emplace(v1.end(), 3.0);
+    v1.emplace(v1.end(), 4.0);
+    v1.emplace(v1.end(), 5.0);
 
     std::vector<double> v2{ 1, 2 };
     v2.emplace(v2.end(), 3.0);
@@ -541,7 +557,9 @@ TEST(vector_modifiers, emplace3) {
 
 TEST(vector_modifiers, emplace4) {
     sfleta_::vector<double> v1{};
-    v1.emplace((v1.end()), 1.0, 2.0, 3.0);
+    v1.emplace(v1.end(), 1.0);
+    v1.emplace(v1.end(), 2.0);
+    v1.emplace(v1.end(), 3.0);
 
     std::vector<double> v2{};
     v2.emplace(v2.end(), 1.0);
@@ -554,7 +572,9 @@ TEST(vector_modifiers, emplace4) {
 
 TEST(vector_modifiers, emplace_back) {
     sfleta_::vector<double> v1{};
-    v1.emplace_back(1.0, 2.0, 3.0);
+    v1.emplace_back(1.0);
+    v1.emplace_back(2.0);
+    v1.emplace_back(3.0);
 
     std::vector<double> v2{};
     v2.emplace_back(1.0);
@@ -567,7 +587,9 @@ TEST(vector_modifiers, emplace_back) {
 
 TEST(vector_modifiers, emplace_back2) {
     sfleta_::vector<double> v1{ -1, 0 };
-    v1.emplace_back(1.0, 2.0, 3.0);
+    v1.emplace_back(1.0);
+    v1.emplace_back(2.0);
+    v1.emplace_back(3.0);
 
     std::vector<double> v2{ -1, 0 };
     v2.emplace_back(1.0);
@@ -578,6 +600,410 @@ TEST(vector_modifiers, emplace_back2) {
     ASSERT_EQ(*(v1.data()), *(v2.data()));
 }
 
+struct Tracked {
+    static int alive;
+    static int copies;
+    std::string value;
+    explicit Tracked(const std::string& v) : value(v) { ++alive; }
+    Tracked(const Tracked& other) : value(other.value) { ++alive; ++copies; }
+    Tracked(Tracked&& other) noexcept : value(std::move(other.value)) { ++alive; }
+    Tracked& operator=(const Tracked& other) { value = other.value; ++copies; return *this; }
+    Tracked& operator=(Tracked&& other) noexcept { value = std::move(other.value); return *this; }
+    ~Tracked() { --alive; }
+};
+int Tracked::alive = 0;
+int Tracked::copies = 0;
+
+TEST(vector_storage, reserve_constructs_nothing) {
+    {
+        sfleta_::vector<Tracked> v1;
+        v1.reserve(100);
+        ASSERT_EQ(Tracked::alive, 0);
+        ASSERT_EQ(v1.capacity(), 100u);
+        v1.push_back(Tracked("a"));
+        ASSERT_EQ(Tracked::alive, 1);
+    }
+    ASSERT_EQ(Tracked::alive, 0);
+}
+
+TEST(vector_storage, growth_moves) {
+    Tracked::copies = 0;
+    {
+        sfleta_::vector<Tracked> v1;
+        Tracked item("item");
+        for (int i = 0; i < 1000; ++i) v1.push_back(item);
+        ASSERT_EQ(Tracked::copies, 1000);
+        v1.shrink_to_fit();
+        ASSERT_EQ(Tracked::copies, 1000);
+        ASSERT_EQ(v1[999].value, "item");
+    }
+    ASSERT_EQ(Tracked::alive, 0);
+}
+
+TEST(vector_storage, erase_destroys) {
+    {
+        sfleta_::vector<Tracked> v1;
+        for (int i = 0; i < 10; ++i) v1.push_back(Tracked(std::to_string(i)));
+        v1.erase(v1.begin() + 3);
+        v1.pop_back();
+        ASSERT_EQ(Tracked::alive, 8);
+        ASSERT_EQ(v1[3].value, "4");
+        v1.clear();
+        ASSERT_EQ(Tracked::alive, 0);
+    }
+    ASSERT_EQ(Tracked::alive, 0);
+}
+
+TEST(vector_storage, strings) {
+    sfleta_::vector<std::string> v1;
+    std::vector<std::string> v2;
+    for (int i = 0; i < 500; ++i) {
+        std::string s(40, static_cast<char>('a' + i % 26));
+        v1.insert(v1.begin() + (i % (v1.size() + 1)), s);
+        v2.insert(v2.begin() + (i % (v2.size() + 1)), s);
+    }
+    v1.push_back(v1[0]);
+    v2.push_back(v2[0]);
+    ASSERT_EQ(v1.size(), v2.size());
+    ASSERT_EQ(v1.capacity(), v2.capacity());
+    ASSERT_TRUE(std::equal(v1.begin(), v1.end(), v2.begin()));
+}
+
+struct Boxed {
+    int* value;
+    explicit Boxed(int v) : value(new int(v)) {}
+    Boxed(const Boxed& other) : value(new int(*other.value)) {}
+    Boxed& operator=(const Boxed& other) { *value = *other.value; return *this; }
+    ~Boxed() { delete value; }
+};
+
+namespace sfleta_ {
+template <>
+struct is_trivially_relocatable<Boxed> : std::true_type {};
+}  // namespace sfleta_
+
+TEST(vector_storage, pod_insert_erase) {
+    sfleta_::vector<uint64_t> v1;
+    std::vector<uint64_t> v2;
+    for (uint64_t i = 0; i < 2000; ++i) {
+        v1.insert(v1.begin() + i / 2, i);
+        v2.insert(v2.begin() + i / 2, i);
+    }
+    for (size_t i = 0; i < 500; ++i) {
+        v1.erase(v1.begin() + i);
+        v2.erase(v2.begin() + i);
+    }
+    sfleta_::vector<uint64_t> v3(v1);
+    ASSERT_EQ(v3.size(), v2.size());
+    ASSERT_TRUE(std::equal(v3.begin(), v3.end(), v2.begin()));
+}
+
+TEST(vector_storage, relocatable_type) {
+    sfleta_::vector<Boxed> v1;
+    std::vector<int> v2;
+    for (int i = 0; i < 300; ++i) {
+        v1.insert(v1.begin() + i / 3, Boxed(i));
+        v2.insert(v2.begin() + i / 3, i);
+    }
+    v1.erase(v1.begin() + 10);
+    v2.erase(v2.begin() + 10);
+    v1.shrink_to_fit();
+    ASSERT_EQ(v1.size(), v2.size());
+    for (size_t i = 0; i < v2.size(); ++i) {
+        ASSERT_EQ(*v1[i].value, v2[i]);
+    }
+}
+
+TEST(vector_storage, default_no_allocation) {
+    static_assert(std::is_nothrow_default_constructible_v<sfleta_::vector<std::string>>);
+    static_assert(std::is_nothrow_move_constructible_v<sfleta_::vector<std::string>>);
+    static_assert(std::is_nothrow_move_assignable_v<sfleta_::vector<std::string>>);
+    sfleta_::vector<int> v1;
+    ASSERT_EQ(v1.data(), nullptr);
+    ASSERT_EQ(v1.capacity(), 0U);
+    ASSERT_TRUE(v1.begin() == v1.end());
+    v1.push_back(1);
+    v1.clear();
+    v1.shrink_to_fit();
+    ASSERT_EQ(v1.data(), nullptr);
+    sfleta_::vector<Tracked> v2;
+    v2.shrink_to_fit();
+    ASSERT_EQ(v2.data(), nullptr);
+}
+
+TEST(vector_storage, moved_from_reusable) {
+    sfleta_::vector<std::string> v1{"a", "b", "c"};
+    sfleta_::vector<std::string> v2(std::move(v1));
+    ASSERT_EQ(v1.size(), 0U);
+    ASSERT_EQ(v1.data(), nullptr);
+    v1.push_back("d");
+    ASSERT_EQ(v1.size(), 1U);
+    ASSERT_EQ(v1[0], "d");
+    v2 = std::move(v1);
+    ASSERT_EQ(v2.size(), 1U);
+    ASSERT_EQ(v2[0], "d");
+    ASSERT_EQ(v1.capacity(), 0U);
+}
+
+TEST(vector_storage, aligned_growth) {
+    sfleta_::aligned_vector<float, 64> v1;
+    static_assert(decltype(v1)::alignment() == 64);
+    for (int i = 0; i < 1000; ++i) {
+        v1.push_back(static_cast<float>(i));
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(v1.data()) % 64, 0U);
+    }
+    v1.resize(10);
+    v1.shrink_to_fit();
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(v1.data()) % 64, 0U);
+    ASSERT_EQ(v1.aligned_data(), v1.data());
+    ASSERT_EQ(v1[9], 9.0f);
+}
+
+TEST(vector_storage, aligned_copy_move) {
+    sfleta_::aligned_vector<std::string, 32> v1;
+    for (int i = 0; i < 50; ++i) v1.emplace_back(std::to_string(i));
+    sfleta_::aligned_vector<std::string, 32> v2(v1);
+    sfleta_::aligned_vector<std::string, 32> v3(std::move(v1));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(v2.data()) % 32, 0U);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(v3.data()) % 32, 0U);
+    ASSERT_EQ(v2[49], "49");
+    ASSERT_EQ(v3[49], "49");
+    static_assert(sfleta_::vector<int>::alignment() == alignof(int));
+}
+
+TEST(vector_growth, factor) {
+    sfleta_::vector<int, sfleta_::growth_golden> v1;
+    std::vector<size_t> capacities;
+    for (int i = 0; i < 20; ++i) {
+        v1.push_back(i);
+        if (capacities.empty() || capacities.back() != v1.capacity()) capacities.push_back(v1.capacity());
+    }
+    ASSERT_EQ(capacities, std::vector<size_t>({1, 2, 3, 4, 6, 9, 13, 19, 28}));
+    ASSERT_EQ(v1[19], 19);
+}
+
+TEST(vector_growth, chunk) {
+    sfleta_::vector<int, sfleta_::growth_chunk<100>> v1;
+    for (int i = 0; i < 250; ++i) v1.insert(v1.begin(), i);
+    ASSERT_EQ(v1.capacity(), 300u);
+    ASSERT_EQ(v1[0], 249);
+    ASSERT_EQ(v1[249], 0);
+}
+
+TEST(vector_growth, capped) {
+    using policy = sfleta_::growth_capped<sfleta_::growth_double, 1000>;
+    sfleta_::vector<char, policy> v1;
+    v1.reserve(5000);
+    for (int i = 0; i < 5001; ++i) v1.push_back('a');
+    ASSERT_EQ(v1.capacity(), 6001u);
+    ASSERT_EQ(policy::next(10, 11), 20u);
+}
+
+TEST(vector_growth, no_overflow) {
+    size_t huge = std::numeric_limits<size_t>::max() - 10;
+    ASSERT_EQ(sfleta_::growth_double::next(huge, huge + 1), std::numeric_limits<size_t>::max());
+    size_t big = size_t(5) << 32;
+    ASSERT_EQ(sfleta_::growth_golden::next(big, big + 1), big + big / 2);
+}
+
+TEST(vector_modifiers, emplace_in_place) {
+    sfleta_::vector<std::pair<std::string, int>> v1;
+    auto& back = v1.emplace_back("b", 2);
+    ASSERT_EQ(back.first, "b");
+    v1.emplace(v1.begin(), "a", 1);
+    v1.emplace(v1.end(), std::string(3, 'c'), 3);
+    ASSERT_EQ(v1.size(), 3u);
+    ASSERT_EQ(v1[0].first, "a");
+    ASSERT_EQ(v1[2].first, "ccc");
+    ASSERT_EQ(v1[2].second, 3);
+}
+
+TEST(vector_modifiers, move_only) {
+    sfleta_::vector<std::unique_ptr<int>> v1;
+    for (int i = 0; i < 50; ++i) v1.push_back(std::make_unique<int>(i));
+    v1.insert(v1.begin(), std::make_unique<int>(-1));
+    v1.emplace_back(new int(50));
+    ASSERT_EQ(v1.size(), 52u);
+    ASSERT_EQ(*v1[0], -1);
+    ASSERT_EQ(*v1[51], 50);
+}
+
+TEST(vector_modifiers, push_back_rvalue_no_copy) {
+    Tracked::copies = 0;
+    {
+        sfleta_::vector<Tracked> v1;
+        for (int i = 0; i < 100; ++i) v1.push_back(Tracked("x"));
+        v1.insert(v1.begin() + 50, Tracked("y"));
+        v1.emplace(v1.begin(), "z");
+        ASSERT_EQ(v1[51].value, "y");
+        ASSERT_EQ(v1[0].value, "z");
+    }
+    ASSERT_EQ(Tracked::copies, 0);
+    ASSERT_EQ(Tracked::alive, 0);
+}
+
+// single pass iterator over 0, 1, 2, ... that throws when it reaches fail
+struct ThrowingInput {
+    using iterator_category = std::input_iterator_tag;
+    using value_type = int;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const int*;
+    using reference = const int&;
+    int pos;
+    int fail;
+    const int& operator*() const {
+        if (pos == fail) throw std::runtime_error("input failed");
+        return pos;
+    }
+    ThrowingInput& operator++() { ++pos; return *this; }
+    ThrowingInput operator++(int) { ThrowingInput tmp(*this); ++pos; return tmp; }
+    bool operator==(const ThrowingInput& other) const { return pos == other.pos; }
+    bool operator!=(const ThrowingInput& other) const { return pos != other.pos; }
+};
+
+TEST(vector_bulk, insert_range) {
+    sfleta_::vector<std::string> v1{"a", "e"};
+    std::vector<std::string> v2{"a", "e"};
+    std::vector<std::string> batch{"b", "c", "d"};
+    auto it1 = v1.insert(v1.begin() + 1, batch.begin(), batch.end());
+    auto it2 = v2.insert(v2.begin() + 1, batch.begin(), batch.end());
+    ASSERT_EQ(it1 - v1.begin(), it2 - v2.begin());
+    v1.insert(v1.end(), {"f", "g"});
+    v2.insert(v2.end(), {"f", "g"});
+    ASSERT_EQ(v1.size(), v2.size());
+    ASSERT_TRUE(std::equal(v1.begin(), v1.end(), v2.begin()));
+}
+
+TEST(vector_bulk, insert_count_single_reallocation) {
+    sfleta_::vector<int> v1{1, 2, 3};
+    std::vector<int> v2{1, 2, 3};
+    v1.insert(v1.begin() + 1, 1000, v1[2]);
+    v2.insert(v2.begin() + 1, 1000, 3);
+    ASSERT_EQ(v1.capacity(), 1003u);
+    ASSERT_TRUE(std::equal(v1.begin(), v1.end(), v2.begin()));
+    ASSERT_EQ(v1.size(), v2.size());
+}
+
+TEST(vector_bulk, append) {
+    sfleta_::vector<double> v1{0.5};
+    std::list<double> l1{1.5, 2.5, 3.5};
+    v1.append(l1.begin(), l1.end());
+    std::vector<double> v2{0.5, 1.5, 2.5, 3.5};
+    ASSERT_TRUE(eq_container(v1, v2));
+}
+
+TEST(vector_bulk, insert_single_pass_rolls_back) {
+    sfleta_::vector<double> v1{0.5, 1.5, 2.5};
+    std::vector<double> before{0.5, 1.5, 2.5};
+    // fails after growing the buffer past its first capacity
+    ASSERT_THROW(v1.insert(v1.begin() + 1, ThrowingInput{0, 20}, ThrowingInput{30, 0}), std::runtime_error);
+    ASSERT_EQ(v1.size(), before.size());
+    ASSERT_TRUE(std::equal(v1.begin(), v1.end(), before.begin()));
+    sfleta_::vector<int> v2{1, 2};
+    auto it = v2.insert(v2.begin() + 1, ThrowingInput{0, -1}, ThrowingInput{3, -1});
+    ASSERT_EQ(it - v2.begin(), 1);
+    std::vector<int> expected{1, 0, 1, 2, 2};
+    ASSERT_EQ(v2.size(), expected.size());
+    ASSERT_TRUE(std::equal(v2.begin(), v2.end(), expected.begin()));
+}
+
+TEST(vector_bulk, assign) {
+    sfleta_::vector<int> v1{1, 2, 3, 4, 5};
+    std::vector<int> v2{1, 2, 3, 4, 5};
+    v1.assign(3, 7);
+    v2.assign(3, 7);
+    ASSERT_TRUE(eq_container(v1, v2));
+    std::list<int> l1{9, 8, 7, 6, 5, 4};
+    v1.assign(l1.begin(), l1.end());
+    v2.assign(l1.begin(), l1.end());
+    ASSERT_TRUE(eq_container(v1, v2));
+    v1.assign({1, 2});
+    v2.assign({1, 2});
+    ASSERT_TRUE(eq_container(v1, v2));
+}
+
+TEST(vector_bulk, resize) {
+    sfleta_::vector<std::string> v1{"x"};
+    v1.resize(4, "y");
+    ASSERT_EQ(v1.size(), 4u);
+    ASSERT_EQ(v1[3], "y");
+    v1.resize(2);
+    ASSERT_EQ(v1.size(), 2u);
+    v1.resize(5);
+    ASSERT_EQ(v1[4], "");
+    ASSERT_EQ(v1[1], "y");
+    sfleta_::vector<int> v2;
+    v2.resize(3);
+    ASSERT_EQ(v2[0] + v2[1] + v2[2], 0);
+}
+
+TEST(vector_bulk, erase_range) {
+    sfleta_::vector<std::string> v1{"a", "b", "c", "d", "e", "f"};
+    std::vector<std::string> v2{"a", "b", "c", "d", "e", "f"};
+    auto it1 = v1.erase(v1.begin() + 1, v1.begin() + 4);
+    auto it2 = v2.erase(v2.begin() + 1, v2.begin() + 4);
+    ASSERT_EQ(*it1, *it2);
+    ASSERT_EQ(v1.size(), v2.size());
+    ASSERT_TRUE(std::equal(v1.begin(), v1.end(), v2.begin()));
+    v1.erase(v1.begin(), v1.end());
+    ASSERT_TRUE(v1.empty());
+}
+
+TEST(vector_bulk, erase_if) {
+    sfleta_::vector<int> v1;
+    std::vector<int> v2;
+    for (int i = 0; i < 1000; ++i) {
+        v1.push_back(i);
+        v2.push_back(i);
+    }
+    auto pred = [](int x) { return x % 10 == 3; };
+    ASSERT_EQ(sfleta_::erase_if(v1, pred), 100u);
+    v2.erase(std::remove_if(v2.begin(), v2.end(), pred), v2.end());
+    ASSERT_TRUE(eq_container(v1, v2));
+    ASSERT_EQ(sfleta_::erase(v1, 4), 1u);
+    ASSERT_EQ(v1.size(), 899u);
+}
+
+TEST(vector_bulk, erase_if_destroys) {
+    {
+        sfleta_::vector<Tracked> v1;
+        for (int i = 0; i < 20; ++i) v1.push_back(Tracked(std::to_string(i % 4)));
+        Tracked::copies = 0;
+        sfleta_::erase_if(v1, [](const Tracked& t) { return t.value == "1"; });
+        ASSERT_EQ(Tracked::alive, 15);
+        ASSERT_EQ(Tracked::copies, 0);
+        ASSERT_EQ(v1[1].value, "2");
+    }
+    ASSERT_EQ(Tracked::alive, 0);
+}
+
+TEST(vector_bulk, erase_if_relocatable) {
+    sfleta_::vector<Boxed> v1;
+    for (int i = 0; i < 100; ++i) v1.push_back(Boxed(i));
+    sfleta_::erase_if(v1, [](const Boxed& b) { return *b.value < 50; });
+    v1.erase(v1.begin() + 10, v1.begin() + 20);
+    ASSERT_EQ(v1.size(), 40u);
+    ASSERT_EQ(*v1[0].value, 50);
+    ASSERT_EQ(*v1[10].value, 70);
+}
+
+TEST(vector_element_access, no_vtable) {
+    ASSERT_FALSE(std::is_polymorphic_v<sfleta_::vector<int>>);
+    ASSERT_FALSE((std::is_polymorphic_v<sfleta_::array<int, 4>>));
+    ASSERT_EQ(sizeof(sfleta_::vector<int>), 3 * sizeof(void*));
+}
+
+TEST(vector_element_access, unchecked_index_checked_at) {
+    sfleta_::vector<int> v1{1, 2, 3};
+    const sfleta_::vector<int>& cv1 = v1;
+    v1[1] = 20;
+    ASSERT_EQ(cv1[1], 20);
+    ASSERT_THROW(v1.at(3), std::out_of_range);
+    long sum = 0;
+    for (size_t i = 0; i < cv1.size(); ++i) sum += cv1[i];
+    ASSERT_EQ(sum, 24);
+}
+
 // *** array_tests ***//
 TEST(array_constructor_test, empty_constructor) {
     sfleta_::array<double, 1> arr1;
@@ -764,6 +1190,45 @@ TEST(array_modifiers, fill) {
     ASSERT_TRUE(eq_container(arr1, arr2));
 }
 
+TEST(array_storage, inline_trivial) {
+    ASSERT_TRUE((std::is_aggregate_v<sfleta_::array<int, 4>>));
+    ASSERT_TRUE((std::is_trivially_copyable_v<sfleta_::array<int, 4>>));
+    ASSERT_FALSE((std::is_trivially_copyable_v<sfleta_::array<std::string, 4>>));
+    ASSERT_EQ((sizeof(sfleta_::array<int, 4>)), 4 * sizeof(int));
+    ASSERT_TRUE(noexcept(std::declval<sfleta_::array<int, 4>&>()[0]));
+}
+
+TEST(array_storage, constexpr_use) {
+    constexpr sfleta_::array<int, 3> arr1{ 4, 5, 6 };
+    static_assert(arr1[1] == 5);
+    static_assert(arr1.at(2) == 6);
+    static_assert(arr1.size() == 3);
+    constexpr int sum = [] {
+        sfleta_::array<int, 4> tmp{};
+        tmp.fill(2);
+        int total = 0;
+        for (int v : tmp) total += v;
+        return total;
+    }();
+    ASSERT_EQ(sum, 8);
+}
+
+TEST(array_storage, copies_are_independent) {
+    sfleta_::array<std::string, 2> arr1{ "a", "b" };
+    sfleta_::array<std::string, 2> arr2 = arr1;
+    arr2[0] = "z";
+    ASSERT_EQ(arr1[0], "a");
+    arr1 = arr2;
+    ASSERT_EQ(arr1[0], "z");
+    ASSERT_THROW(arr1.at(2), std::out_of_range);
+}
+
+TEST(array_storage, empty_array_iterators) {
+    sfleta_::array<int, 0> arr1{};
+    ASSERT_TRUE(arr1.begin() == arr1.end());
+    ASSERT_TRUE(arr1.empty());
+}
+
 // *** THROW_TEST *** //
 // TEST(vector_constructor_test, param_constructor2) {
 //     ASSERT_ANY_THROW(sfleta_::vector<int> v1(-1));
@@ -921,6 +1386,40 @@ TEST(list_ConstructorsTests, costr_move) {
   ASSERT_EQ(sfleta_l3.size(), 0);
 }
 
+TEST(list_ConstructorsTests, costr_move_sentinel) {
+  static_assert(std::is_nothrow_default_constructible_v<sfleta_::list<int>>);
+  static_assert(std::is_nothrow_move_constructible_v<sfleta_::list<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<sfleta_::list<int>>);
+  sfleta_::list<int> sfleta_l1{1, 2, 3};
+  sfleta_::list<int> sfleta_l2(std::move(sfleta_l1));
+  std::list<int> std_l2{1, 2, 3};
+  ASSERT_TRUE(lists_eq(sfleta_l2, std_l2));
+  ASSERT_EQ(*--sfleta_l2.end(), 3);
+  ASSERT_TRUE(sfleta_l1.begin() == sfleta_l1.end());
+  sfleta_l1.push_back(7);
+  sfleta_l1.push_front(6);
+  std::list<int> std_l1{6, 7};
+  ASSERT_TRUE(lists_eq(sfleta_l1, std_l1));
+  sfleta_l1 = std::move(sfleta_l2);
+  ASSERT_TRUE(lists_eq(sfleta_l1, std_l2));
+  ASSERT_EQ(sfleta_l2.size(), 0U);
+}
+
+TEST(list_ModifiersTests, swap_sentinel) {
+  sfleta_::list<int> sfleta_l1{1, 2, 3};
+  sfleta_::list<int> sfleta_l2;
+  sfleta_l1.swap(sfleta_l2);
+  ASSERT_TRUE(sfleta_l1.begin() == sfleta_l1.end());
+  std::list<int> std_l2{1, 2, 3};
+  ASSERT_TRUE(lists_eq(sfleta_l2, std_l2));
+  ASSERT_EQ(*--sfleta_l2.end(), 3);
+  sfleta_l2.push_back(4);
+  sfleta_l1.swap(sfleta_l2);
+  std_l2.push_back(4);
+  ASSERT_TRUE(lists_eq(sfleta_l1, std_l2));
+  ASSERT_EQ(sfleta_l2.size(), 0U);
+}
+
 TEST(list_ElementAccessTests, front) {
   sfleta_::list<int> sfleta_l0;
   sfleta_::list<int>::const_reference f0 = sfleta_l0.front();
@@ -1924,7 +2423,8 @@ TEST(list_ModifiersTests, emplace_5) {
 
   sfleta_::list<int> sfleta_l1;
   sfleta_::list<int>::const_iterator sfleta_it1 = sfleta_l1.cbegin();
-  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 5, 10);
+  sfleta_l1.emplace(sfleta_it1, 5);
+  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 10);
 
   ASSERT_TRUE(lists_eq(sfleta_l1, std_l1));
   ASSERT_TRUE(*std_r1 == *sfleta_r1);
@@ -1939,7 +2439,8 @@ TEST(list_ModifiersTests, emplace_6) {
 
   sfleta_::list<int> sfleta_l1;
   sfleta_::list<int>::const_iterator sfleta_it1 = sfleta_l1.cend();
-  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 5, 10);
+  sfleta_l1.emplace(sfleta_it1, 5);
+  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 10);
 
   ASSERT_TRUE(lists_eq(sfleta_l1, std_l1));
   ASSERT_TRUE(*std_r1 == *sfleta_r1);
@@ -1956,7 +2457,8 @@ TEST(list_ModifiersTests, emplace_7) {
   sfleta_::list<int> sfleta_l1;
   sfleta_::list<int>::const_iterator sfleta_it1 = sfleta_l1.cend();
   --sfleta_it1;
-  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 5, 10);
+  sfleta_l1.emplace(sfleta_it1, 5);
+  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 10);
 
   ASSERT_TRUE(lists_eq(sfleta_l1, std_l1));
   ASSERT_TRUE(*std_r1 == *sfleta_r1);
@@ -1971,7 +2473,8 @@ TEST(list_ModifiersTests, emplace_8) {
 
   sfleta_::list<int> sfleta_l1{9, 6, 3, 7};
   sfleta_::list<int>::const_iterator sfleta_it1 = sfleta_l1.cbegin();
-  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 5, 10);
+  sfleta_l1.emplace(sfleta_it1, 5);
+  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 10);
 
   ASSERT_TRUE(lists_eq(sfleta_l1, std_l1));
   ASSERT_TRUE(*std_r1 == *sfleta_r1);
@@ -1988,7 +2491,8 @@ TEST(list_ModifiersTests, emplace_9) {
   sfleta_::list<int> sfleta_l1{9, 6, 3, 7};
   sfleta_::list<int>::const_iterator sfleta_it1 = sfleta_l1.cbegin();
   ++sfleta_it1;
-  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 5, 10);
+  sfleta_l1.emplace(sfleta_it1, 5);
+  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 10);
 
   ASSERT_TRUE(lists_eq(sfleta_l1, std_l1));
   ASSERT_TRUE(*std_r1 == *sfleta_r1);
@@ -2006,7 +2510,9 @@ TEST(list_ModifiersTests, emplace_10) {
   sfleta_::list<int> sfleta_l1{9, 6, 3, 7};
   sfleta_::list<int>::const_iterator sfleta_it1 = sfleta_l1.cbegin();
   ++sfleta_it1;
-  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 5, 10, 15);
+  sfleta_l1.emplace(sfleta_it1, 5);
+  sfleta_l1.emplace(sfleta_it1, 10);
+  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 15);
 
   ASSERT_TRUE(lists_eq(sfleta_l1, std_l1));
   ASSERT_TRUE(*std_r1 == *sfleta_r1);
@@ -2022,7 +2528,9 @@ TEST(list_ModifiersTests, emplace_11) {
 
   sfleta_::list<int> sfleta_l1{9, 6, 3, 7};
   sfleta_::list<int>::const_iterator sfleta_it1 = sfleta_l1.cend();
-  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 5, 10, 15);
+  sfleta_l1.emplace(sfleta_it1, 5);
+  sfleta_l1.emplace(sfleta_it1, 10);
+  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 15);
 
   ASSERT_TRUE(lists_eq(sfleta_l1, std_l1));
   ASSERT_TRUE(*std_r1 == *sfleta_r1);
@@ -2040,7 +2548,9 @@ TEST(list_ModifiersTests, emplace_12) {
   sfleta_::list<int> sfleta_l1{9, 6, 3, 7};
   sfleta_::list<int>::const_iterator sfleta_it1 = sfleta_l1.cend();
   --sfleta_it1;
-  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 5, 10, 15);
+  sfleta_l1.emplace(sfleta_it1, 5);
+  sfleta_l1.emplace(sfleta_it1, 10);
+  sfleta_::list<int>::iterator sfleta_r1 = sfleta_l1.emplace(sfleta_it1, 15);
 
   ASSERT_TRUE(lists_eq(sfleta_l1, std_l1));
   ASSERT_TRUE(*std_r1 == *sfleta_r1);
@@ -2083,7 +2593,8 @@ TEST(list_ModifiersTests, emplace_back_3) {
   size_t std_size = std_l1.size();
 
   sfleta_::list<int> sfleta_l1;
-  sfleta_l1.emplace_back(5, 10);
+  sfleta_l1.emplace_back(5);
+  sfleta_l1.emplace_back(10);
   sfleta_::list<int>::size_type sfleta_size = std_l1.size();
 
   ASSERT_TRUE(lists_eq(sfleta_l1, std_l1));
@@ -2114,7 +2625,8 @@ TEST(list_ModifiersTests, emplace_back_5) {
 
   sfleta_::list<int> sfleta_l1;
   sfleta_l1.emplace_back();
-  sfleta_l1.emplace_back(5, 10);
+  sfleta_l1.emplace_back(5);
+  sfleta_l1.emplace_back(10);
   sfleta_::list<int>::size_type sfleta_size = std_l1.size();
 
   ASSERT_TRUE(lists_eq(sfleta_l1, std_l1));
@@ -2147,7 +2659,8 @@ TEST(list_ModifiersTests, emplace_back_7) {
 
   sfleta_::list<int> sfleta_l1{99, 100};
   sfleta_l1.emplace_back();
-  sfleta_l1.emplace_back(5, 10);
+  sfleta_l1.emplace_back(5);
+  sfleta_l1.emplace_back(10);
   sfleta_::list<int>::size_type sfleta_size = std_l1.size();
 
   ASSERT_TRUE(lists_eq(sfleta_l1, std_l1));
@@ -2161,7 +2674,8 @@ TEST(list_ModifiersTests, emplace_back_8) {
   size_t std_size = std_l1.size();
 
   sfleta_::list<int> sfleta_l1{99, 100};
-  sfleta_l1.emplace_back(5, 10);
+  sfleta_l1.emplace_back(5);
+  sfleta_l1.emplace_back(10);
   sfleta_::list<int>::size_type sfleta_size = std_l1.size();
 
   ASSERT_TRUE(lists_eq(sfleta_l1, std_l1));
@@ -2267,12 +2781,38 @@ TEST(list_ModifiersTests, emplace_front_6) {
   size_t std_size = std_l1.size();
 
   sfleta_::list<int> sfleta_l1{99, 100};
-  sfleta_l1.emplace_front(10, 5);
+  sfleta_l1.emplace_front(5);
+  sfleta_l1.emplace_front(10);
   sfleta_::list<int>::size_type sfleta_size = std_l1.size();
 
   ASSERT_TRUE(lists_eq(sfleta_l1, std_l1));
   ASSERT_TRUE(std_size == sfleta_size);
 }
+
+TEST(list_ModifiersTests, emplace_in_place) {
+  sfleta_::list<std::unique_ptr<int>> sfleta_l1;
+  sfleta_l1.emplace_back(new int(2));
+  sfleta_l1.emplace_front(new int(1));
+  sfleta_l1.push_back(std::make_unique<int>(4));
+  auto it = sfleta_l1.end();
+  --it;
+  sfleta_l1.insert(it, std::make_unique<int>(3));
+  int expected = 1;
+  for (auto i = sfleta_l1.begin(); i != sfleta_l1.end(); ++i) {
+    ASSERT_EQ(**i, expected++);
+  }
+  ASSERT_EQ(sfleta_l1.size(), 4u);
+}
+
+TEST(list_ModifiersTests, emplace_returns) {
+  sfleta_::list<std::string> sfleta_l1{"b"};
+  std::string &front = sfleta_l1.emplace_front(3, 'a');
+  ASSERT_EQ(front, "aaa");
+  auto it = sfleta_l1.emplace(sfleta_l1.cend(), "c");
+  ASSERT_EQ(*it, "c");
+  ASSERT_EQ(sfleta_l1.back(), "c");
+}
+
 /* Test throw */
 /*
 TEST(list_ThrowTests, throw_1) {
@@ -2301,7 +2841,10 @@ TEST(list_ThrowTests, throw_5) {
 
 TEST(list_ThrowTests, throw_6) {
   sfleta_::list<int> sfleta_l1{5, 6};
-  EXPECT_THROW(sfleta_l1 = std::move(sfleta_l1), std::exception);
+  EXPECT_NO_THROW(sfleta_l1 = std::move(sfleta_l1));
+  EXPECT_EQ(sfleta_l1.size(), 2U);
+  EXPECT_EQ(sfleta_l1.front(), 5);
+  EXPECT_EQ(sfleta_l1.back(), 6);
 }
 
 TEST(list_ThrowTests, throw_7) {
@@ -2472,10 +3015,29 @@ TEST(set_modifiers, insert3) {
 TEST(set_modifiers, emplace) {
     sfleta_::set<int> s1 {};
     std::set<int> s2 {8, 2, 3, 5, 6};
-    s1.emplace(8, 2, 3, 5, 6);
+    s1.emplace(8);
+    s1.emplace(2);
+    s1.emplace(3);
+    s1.emplace(5);
+    s1.emplace(6);
     ASSERT_TRUE(eq_set(s1, s2));
 }
 
+TEST(set_modifiers, emplace_result) {
+    sfleta_::set<std::string> s1;
+    auto res = s1.emplace(3, 'x');
+    ASSERT_TRUE(res.second);
+    ASSERT_EQ(*res.first, "xxx");
+    ASSERT_FALSE(s1.emplace("xxx").second);
+    std::string moved(20, 'm');
+    ASSERT_TRUE(s1.insert(std::move(moved)).second);
+    ASSERT_EQ(s1.size(), 2u);
+    sfleta_::multiset<std::string> s2;
+    ASSERT_EQ(*s2.emplace(2, 'y'), "yy");
+    ASSERT_EQ(*s2.emplace(2, 'y'), "yy");
+    ASSERT_EQ(s2.size(), 2u);
+}
+
 TEST(set_modifiers, erase) {
     int value = 5;
     sfleta_::set<int> s1 {8, 7, 6, 5, 4, 3, 2, 1};
@@ -2737,7 +3299,15 @@ TEST(multiset_modifiers, insert3) {
 TEST(multiset_modifiers, emplace) {
     sfleta_::multiset<int> s1 {};
     std::multiset<int> s2 {8, 2, 3, 5, 6, 6, 7, 7, 8};
-    s1.emplace(8, 2, 3, 5, 6, 6, 7, 7, 8);
+    s1.emplace(8);
+    s1.emplace(2);
+    s1.emplace(3);
+    s1.emplace(5);
+    s1.emplace(6);
+    s1.emplace(6);
+    s1.emplace(7);
+    s1.emplace(7);
+    s1.emplace(8);
     ASSERT_TRUE(eq_multiset(s1, s2));
 }
 
@@ -2908,6 +3478,1334 @@ TEST(multiset_member_functions, move_constructor) {
     ASSERT_EQ(s1.empty(), s2.empty());
 }
 
+//  counted_multiset tests
+
+TEST(counted_multiset, insert_count) {
+    sfleta_::counted_multiset<int> s1 {3, 1, 3, 3, 2};
+    std::multiset<int> s2 {3, 1, 3, 3, 2};
+    s1.insert(1);
+    s2.insert(1);
+    s1.insert(7, 1000000);
+    ASSERT_EQ(s1.count(3), s2.count(3));
+    ASSERT_EQ(s1.count(1), s2.count(1));
+    ASSERT_EQ(s1.count(5), s2.count(5));
+    ASSERT_EQ(s1.count(7), 1000000u);
+    ASSERT_EQ(s1.size(), s2.size() + 1000000);
+    ASSERT_EQ(s1.distinct_size(), 4u);
+}
+
+TEST(counted_multiset, iterate_occurrences) {
+    sfleta_::counted_multiset<int> s1 {5, 2, 5, 8, 2, 2};
+    std::multiset<int> s2 {5, 2, 5, 8, 2, 2};
+    auto it2 = s2.begin();
+    for (auto value : s1) {
+        ASSERT_EQ(value, *it2);
+        ++it2;
+    }
+    auto it1 = s1.end();
+    --it1;
+    ASSERT_EQ(*it1, 8);
+    --it1;
+    ASSERT_EQ(*it1, 5);
+    ASSERT_EQ(it1.multiplicity(), 2u);
+}
+
+TEST(counted_multiset, erase) {
+    sfleta_::counted_multiset<int> s1 {4, 4, 4, 1, 9};
+    std::multiset<int> s2 {4, 4, 4, 1, 9};
+    s1.erase(s1.find(4));
+    s2.erase(s2.find(4));
+    ASSERT_EQ(s1.count(4), s2.count(4));
+    ASSERT_EQ(s1.erase(4), s2.erase(4));
+    s1.erase(s1.find(9));
+    s2.erase(s2.find(9));
+    ASSERT_EQ(s1.size(), s2.size());
+    ASSERT_FALSE(s1.contains(4));
+    ASSERT_FALSE(s1.contains(9));
+    ASSERT_EQ(*s1.begin(), 1);
+}
+
+TEST(counted_multiset, bounds) {
+    sfleta_::counted_multiset<int> s1 {1, 3, 3, 3, 6, 6};
+    std::multiset<int> s2 {1, 3, 3, 3, 6, 6};
+    ASSERT_EQ(*s1.lower_bound(2), *s2.lower_bound(2));
+    ASSERT_EQ(*s1.upper_bound(3), *s2.upper_bound(3));
+    ASSERT_TRUE(s1.upper_bound(6) == s1.end());
+    auto range = s1.equal_range(3);
+    size_t n = 0;
+    for (auto it = range.first; it != range.second; ++it) ++n;
+    ASSERT_EQ(n, s2.count(3));
+}
+
+TEST(counted_multiset, copy_move_merge) {
+    sfleta_::counted_multiset<int> s1 {2, 2, 1};
+    sfleta_::counted_multiset<int> s2(s1);
+    sfleta_::counted_multiset<int> s3(std::move(s1));
+    ASSERT_TRUE(s1.empty());
+    ASSERT_EQ(s2.count(2), 2u);
+    ASSERT_EQ(s3.size(), 3u);
+    s3.merge(s2);
+    ASSERT_TRUE(s2.empty());
+    ASSERT_EQ(s3.count(2), 4u);
+    ASSERT_EQ(s3.size(), 6u);
+}
+
+//  set algebra tests
+
+TEST(set_algebra, set_union) {
+    sfleta_::set<int> a {1, 3, 5, 7, 9};
+    sfleta_::set<int> b {2, 3, 4, 9, 11};
+    std::set<int> a2 {1, 3, 5, 7, 9};
+    std::set<int> b2 {2, 3, 4, 9, 11};
+    std::set<int> res2;
+    std::set_union(a2.begin(), a2.end(), b2.begin(), b2.end(), std::inserter(res2, res2.end()));
+    sfleta_::set<int> res1 = sfleta_::set_union(a, b);
+    ASSERT_TRUE(eq_set(res1, res2));
+}
+
+TEST(set_algebra, set_intersection) {
+    sfleta_::set<int> a {1, 3, 5, 7, 9};
+    sfleta_::set<int> b {2, 3, 4, 9, 11};
+    sfleta_::set<int> res1 = sfleta_::set_intersection(a, b);
+    std::set<int> res2 {3, 9};
+    ASSERT_TRUE(eq_set(res1, res2));
+    ASSERT_TRUE(sfleta_::set_intersection(a, sfleta_::set<int>()).empty());
+}
+
+TEST(set_algebra, difference) {
+    sfleta_::set<int> a {1, 3, 5, 7, 9};
+    sfleta_::set<int> b {2, 3, 4, 9, 11};
+    sfleta_::set<int> res1 = sfleta_::set_difference(a, b);
+    sfleta_::set<int> res3 = sfleta_::set_symmetric_difference(a, b);
+    std::set<int> res2 {1, 5, 7};
+    std::set<int> res4 {1, 2, 4, 5, 7, 11};
+    ASSERT_TRUE(eq_set(res1, res2));
+    ASSERT_TRUE(eq_set(res3, res4));
+}
+
+TEST(set_algebra, gallop) {
+    sfleta_::set<int> large;
+    std::set<int> large2;
+    for (int i = 0; i < 5000; i += 3) {
+        large.insert(i);
+        large2.insert(i);
+    }
+    sfleta_::set<int> small {-1, 0, 9, 10, 2400, 4998, 4999, 7000};
+    std::set<int> small2 {-1, 0, 9, 10, 2400, 4998, 4999, 7000};
+    std::set<int> inter2, diff2;
+    std::set_intersection(small2.begin(), small2.end(), large2.begin(), large2.end(),
+                          std::inserter(inter2, inter2.end()));
+    std::set_difference(small2.begin(), small2.end(), large2.begin(), large2.end(),
+                        std::inserter(diff2, diff2.end()));
+    ASSERT_TRUE(eq_set(sfleta_::set_intersection(large, small), inter2));
+    ASSERT_TRUE(eq_set(sfleta_::set_difference(small, large), diff2));
+    ASSERT_TRUE(sfleta_::includes(large, sfleta_::set<int> {0, 9, 2400, 4998}));
+    ASSERT_FALSE(sfleta_::includes(large, sfleta_::set<int> {0, 9, 2401}));
+}
+
+TEST(set_algebra, multiset) {
+    sfleta_::multiset<int> a {1, 1, 1, 2, 3, 3};
+    sfleta_::multiset<int> b {1, 3, 3, 3, 4};
+    std::multiset<int> a2 {1, 1, 1, 2, 3, 3};
+    std::multiset<int> b2 {1, 3, 3, 3, 4};
+    std::multiset<int> uni2, inter2, diff2, sym2;
+    std::set_union(a2.begin(), a2.end(), b2.begin(), b2.end(), std::inserter(uni2, uni2.end()));
+    std::set_intersection(a2.begin(), a2.end(), b2.begin(), b2.end(), std::inserter(inter2, inter2.end()));
+    std::set_difference(a2.begin(), a2.end(), b2.begin(), b2.end(), std::inserter(diff2, diff2.end()));
+    std::set_symmetric_difference(a2.begin(), a2.end(), b2.begin(), b2.end(),
+                                  std::inserter(sym2, sym2.end()));
+    ASSERT_TRUE(eq_multiset(sfleta_::set_union(a, b), uni2));
+    ASSERT_TRUE(eq_multiset(sfleta_::set_intersection(a, b), inter2));
+    ASSERT_TRUE(eq_multiset(sfleta_::set_difference(a, b), diff2));
+    ASSERT_TRUE(eq_multiset(sfleta_::set_symmetric_difference(a, b), sym2));
+    ASSERT_TRUE(sfleta_::includes(a, sfleta_::multiset<int> {1, 1, 3}));
+    ASSERT_FALSE(sfleta_::includes(a, sfleta_::multiset<int> {2, 2}));
+}
+
+TEST(set_algebra, modify_result) {
+    sfleta_::set<int> a {1, 3, 5, 7, 9, 11, 13};
+    sfleta_::set<int> b {2, 4, 6, 8, 10};
+    sfleta_::set<int> res1 = sfleta_::set_union(a, b);
+    std::set<int> res2 {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 13};
+    res1.insert(12);
+    res2.insert(12);
+    res1.erase(res1.find(1));
+    res2.erase(1);
+    res1.erase(res1.find(13));
+    res2.erase(13);
+    res1.insert(0);
+    res2.insert(0);
+    ASSERT_TRUE(eq_set(res1, res2));
+}
+
+//  int_set tests
+
+bool eq_int_set(const sfleta_::int_set& s1, const std::set<uint32_t>& s2) {
+    if (s1.size() != s2.size()) {
+        std::cout << "fail on size" << std::endl;
+        return false;
+    }
+    auto it2 = s2.begin();
+    for (auto value : s1) {
+        if (value != *it2) {
+            std::cout << "fail on " << value << std::endl;
+            return false;
+        }
+        ++it2;
+    }
+    return true;
+}
+
+TEST(int_set, insert_erase) {
+    sfleta_::int_set s1 {5, 70000, 3, 1u << 31, 5};
+    std::set<uint32_t> s2 {5, 70000, 3, 1u << 31, 5};
+    auto p1 = s1.insert(70001);
+    auto p2 = s2.insert(70001);
+    ASSERT_EQ(*p1.first, *p2.first);
+    ASSERT_EQ(p1.second, p2.second);
+    ASSERT_FALSE(s1.insert(3).second);
+    ASSERT_EQ(s1.erase(70000), s2.erase(70000));
+    ASSERT_EQ(s1.erase(4), s2.erase(4));
+    s1.erase(s1.find(1u << 31));
+    s2.erase(1u << 31);
+    ASSERT_TRUE(eq_int_set(s1, s2));
+    ASSERT_TRUE(s1.contains(70001));
+    ASSERT_FALSE(s1.contains(70000));
+}
+
+TEST(int_set, dense_chunk) {
+    sfleta_::int_set s1;
+    std::set<uint32_t> s2;
+    for (uint32_t i = 0; i < 20000; i += 2) {
+        s1.insert(i);
+        s2.insert(i);
+    }
+    ASSERT_TRUE(eq_int_set(s1, s2));
+    for (uint32_t i = 0; i < 20000; i += 3) {
+        ASSERT_EQ(s1.erase(i), s2.erase(i));
+    }
+    ASSERT_TRUE(eq_int_set(s1, s2));
+    auto it1 = s1.end();
+    --it1;
+    ASSERT_EQ(*it1, *s2.rbegin());
+}
+
+TEST(int_set, rank) {
+    sfleta_::int_set s1;
+    for (uint32_t i = 0; i < 10000; ++i) s1.insert(i * 7);
+    ASSERT_EQ(s1.rank(0), 1u);
+    ASSERT_EQ(s1.rank(6), 1u);
+    ASSERT_EQ(s1.rank(7), 2u);
+    ASSERT_EQ(s1.rank(69993), 10000u);
+    ASSERT_EQ(s1.rank(100000), 10000u);
+}
+
+TEST(int_set, algebra) {
+    sfleta_::int_set a, b;
+    std::set<uint32_t> a2, b2;
+    for (uint32_t i = 0; i < 30000; i += 3) {
+        a.insert(i);
+        a2.insert(i);
+    }
+    for (uint32_t i = 0; i < 200000; i += 5) {
+        b.insert(i);
+        b2.insert(i);
+    }
+    std::set<uint32_t> uni2, inter2, diff2, sym2;
+    std::set_union(a2.begin(), a2.end(), b2.begin(), b2.end(), std::inserter(uni2, uni2.end()));
+    std::set_intersection(a2.begin(), a2.end(), b2.begin(), b2.end(), std::inserter(inter2, inter2.end()));
+    std::set_difference(a2.begin(), a2.end(), b2.begin(), b2.end(), std::inserter(diff2, diff2.end()));
+    std::set_symmetric_difference(a2.begin(), a2.end(), b2.begin(), b2.end(),
+                                  std::inserter(sym2, sym2.end()));
+    ASSERT_TRUE(eq_int_set(sfleta_::set_union(a, b), uni2));
+    ASSERT_TRUE(eq_int_set(sfleta_::set_intersection(a, b), inter2));
+    ASSERT_TRUE(eq_int_set(sfleta_::set_difference(a, b), diff2));
+    ASSERT_TRUE(eq_int_set(sfleta_::set_symmetric_difference(a, b), sym2));
+}
+
+TEST(int_set, copy_move_merge) {
+    sfleta_::int_set s1 {1, 2, 3, 100000};
+    sfleta_::int_set s2(s1);
+    sfleta_::int_set s3(std::move(s1));
+    ASSERT_TRUE(s1.empty());
+    ASSERT_TRUE(eq_int_set(s2, {1, 2, 3, 100000}));
+    sfleta_::int_set s4 {3, 4, 5};
+    s3.merge(s4);
+    ASSERT_TRUE(eq_int_set(s3, {1, 2, 3, 4, 5, 100000}));
+    ASSERT_TRUE(eq_int_set(s4, {3}));
+}
+
+//  art_map tests
+
+TEST(art_map, insert_find) {
+    sfleta_::art_map<uint64_t, int> m1;
+    std::map<uint64_t, int> m2;
+    for (uint64_t i = 0; i < 5000; ++i) {
+        uint64_t key = i * 2654435761u;
+        ASSERT_EQ(m1.insert(key, i).second, m2.insert({key, i}).second);
+    }
+    ASSERT_FALSE(m1.insert(0, 1).second);
+    ASSERT_EQ(m1.size(), m2.size());
+    ASSERT_EQ(m1.find(2654435761u)->second, 1);
+    ASSERT_TRUE(m1.find(3) == m1.end());
+    ASSERT_TRUE(m1.contains(uint64_t(2654435761u) * 2));
+    ASSERT_THROW(m1.at(5), std::out_of_range);
+    auto it2 = m2.begin();
+    for (auto it1 = m1.begin(); it1 != m1.end(); ++it1, ++it2) {
+        ASSERT_EQ(it1->first, it2->first);
+        ASSERT_EQ(it1->second, it2->second);
+    }
+}
+
+TEST(art_map, signed_keys) {
+    sfleta_::art_map<int, int> m1 {{-5, 1}, {3, 2}, {0, 3}, {-100, 4}, {77, 5}};
+    std::map<int, int> m2 {{-5, 1}, {3, 2}, {0, 3}, {-100, 4}, {77, 5}};
+    auto it2 = m2.begin();
+    for (auto it1 = m1.begin(); it1 != m1.end(); ++it1, ++it2) {
+        ASSERT_EQ(it1->first, it2->first);
+    }
+    ASSERT_EQ(m1.lower_bound(-6)->first, m2.lower_bound(-6)->first);
+    ASSERT_EQ(m1.lower_bound(1)->first, m2.lower_bound(1)->first);
+    ASSERT_TRUE(m1.lower_bound(78) == m1.end());
+}
+
+TEST(art_map, erase) {
+    sfleta_::art_map<uint32_t, int> m1;
+    std::map<uint32_t, int> m2;
+    for (uint32_t i = 0; i < 3000; ++i) {
+        m1[i * 7] = i;
+        m2[i * 7] = i;
+    }
+    for (uint32_t i = 0; i < 3000; i += 2) {
+        ASSERT_EQ(m1.erase(i * 7), m2.erase(i * 7));
+    }
+    ASSERT_EQ(m1.erase(1), 0u);
+    m1.erase(m1.find(7));
+    m2.erase(7);
+    ASSERT_EQ(m1.size(), m2.size());
+    auto it2 = m2.begin();
+    for (auto it1 = m1.begin(); it1 != m1.end(); ++it1, ++it2) {
+        ASSERT_EQ(it1->first, it2->first);
+        ASSERT_EQ(it1->second, it2->second);
+    }
+}
+
+TEST(art_map, string_keys) {
+    sfleta_::art_map<std::string, int> m1 {{"abc", 1}, {"ab", 2}, {"", 3}, {"abd", 4}, {"b", 5}, {"abcd", 6}};
+    std::map<std::string, int> m2 {{"abc", 1}, {"ab", 2}, {"", 3}, {"abd", 4}, {"b", 5}, {"abcd", 6}};
+    auto it2 = m2.begin();
+    for (auto it1 = m1.begin(); it1 != m1.end(); ++it1, ++it2) {
+        ASSERT_EQ(it1->first, it2->first);
+    }
+    ASSERT_EQ(m1.lower_bound("abca")->first, "abcd");
+    ASSERT_EQ(m1.erase("ab"), 1u);
+    ASSERT_EQ(m1.erase("abc"), 1u);
+    ASSERT_EQ(m1.at("abcd"), 6);
+    ASSERT_EQ(m1.size(), 4u);
+}
+
+TEST(art_map, prefix_range) {
+    sfleta_::art_map<std::string, int> m1;
+    m1.insert("http://a.com/", 1);
+    m1.insert("http://a.com/x", 2);
+    m1.insert("http://a.com/y/z", 3);
+    m1.insert("http://b.com/", 4);
+    m1.insert("http://a.co", 5);
+    auto range = m1.prefix_range("http://a.com/");
+    std::vector<int> values;
+    for (auto it = range.first; it != range.second; ++it) values.push_back(it->second);
+    ASSERT_EQ(values, std::vector<int>({1, 2, 3}));
+    range = m1.prefix_range("ftp://");
+    ASSERT_TRUE(range.first == range.second);
+}
+
+TEST(interval_map, insert_iterate) {
+    sfleta_::interval_map<int, char> m;
+    ASSERT_TRUE(m.empty());
+    m.insert(5, 10, 'a');
+    m.insert(1, 3, 'b');
+    m.insert(5, 6, 'c');
+    m.insert(8, 20, 'd');
+    ASSERT_EQ(m.size(), 4u);
+    std::vector<int> starts;
+    for (auto it = m.begin(); it != m.end(); ++it) starts.push_back(it.lo());
+    ASSERT_EQ(starts, std::vector<int>({1, 5, 5, 8}));
+    ASSERT_THROW(m.insert(4, 3, 'e'), std::invalid_argument);
+}
+
+TEST(interval_map, overlapping) {
+    sfleta_::interval_map<int, int> m;
+    m.insert(15, 20, 0);
+    m.insert(10, 30, 1);
+    m.insert(17, 19, 2);
+    m.insert(5, 20, 3);
+    m.insert(12, 15, 4);
+    m.insert(30, 40, 5);
+    auto found = m.overlapping(6, 11);
+    std::vector<int> values;
+    for (size_t i = 0; i < found.size(); ++i) values.push_back(found[i].value());
+    ASSERT_EQ(values, std::vector<int>({3, 1}));
+    ASSERT_EQ(m.overlapping(41, 50).size(), 0u);
+    ASSERT_EQ(m.overlapping(0, 100).size(), 6u);
+}
+
+TEST(interval_map, stabbing) {
+    sfleta_::interval_map<int, int> m;
+    m.insert(0, 10, 0);
+    m.insert(10, 10, 1);
+    m.insert(11, 12, 2);
+    ASSERT_EQ(m.stabbing(10).size(), 2u);
+    ASSERT_EQ(m.stabbing(11).size(), 1u);
+    ASSERT_EQ(m.stabbing(13).size(), 0u);
+    ASSERT_EQ(m.stabbing(-1).size(), 0u);
+}
+
+TEST(interval_map, erase) {
+    sfleta_::interval_map<int, int> m;
+    for (int i = 0; i < 200; ++i) m.insert(i, i + (i % 7) * 10, i);
+    for (auto it = m.begin(); it != m.end();) {
+        auto next = it;
+        ++next;
+        if (it.lo() % 3 == 0) m.erase(it);
+        it = next;
+    }
+    ASSERT_EQ(m.size(), 133u);
+    for (int lo = 0; lo < 260; lo += 13) {
+        size_t expected = 0;
+        for (int i = 0; i < 200; ++i) {
+            if (i % 3 != 0 && i <= lo + 5 && i + (i % 7) * 10 >= lo) ++expected;
+        }
+        ASSERT_EQ(m.overlapping(lo, lo + 5).size(), expected);
+    }
+}
+
+TEST(interval_map, copy_move) {
+    sfleta_::interval_map<int, std::string> m1;
+    m1.insert(1, 4, "one");
+    m1.insert(3, 9, "two");
+    sfleta_::interval_map<int, std::string> m2(m1);
+    sfleta_::interval_map<int, std::string> m3(std::move(m1));
+    ASSERT_EQ(m2.size(), 2u);
+    ASSERT_EQ(m3.size(), 2u);
+    ASSERT_EQ(m2.stabbing(8)[0].value(), "two");
+    ASSERT_EQ(m3.stabbing(2)[0].value(), "one");
+    m2.clear();
+    ASSERT_TRUE(m2.empty());
+}
+
+TEST(interval_map, plain_tree_pays_nothing) {
+    // the update policy is resolved at compile time, no vtable in the tree
+    using plain_map = sfleta_::Map<int, int>;
+    ASSERT_FALSE(std::is_polymorphic_v<plain_map>);
+    ASSERT_FALSE(std::has_virtual_destructor_v<plain_map>);
+    ASSERT_EQ(sizeof(plain_map), 2 * sizeof(void*) + sizeof(size_t));
+    sfleta_::interval_map<int, int> m;
+    for (int i = 0; i < 100; ++i) m.insert(i, i + (i % 7 == 0 ? 50 : 0), i);
+    ASSERT_EQ(m.stabbing(120).size(), 5u);  // 70, 77, 84, 91, 98
+    ASSERT_EQ(m.overlapping(60, 60).size(), 8u);  // 14 to 56 by 7, and 60 itself
+}
+
+TEST(small_vector, stays_inline) {
+    sfleta_::small_vector<int, 8> v1;
+    ASSERT_TRUE(v1.is_inline());
+    ASSERT_EQ(v1.capacity(), 8u);
+    for (int i = 0; i < 8; ++i) v1.push_back(i);
+    ASSERT_TRUE(v1.is_inline());
+    v1.push_back(8);
+    ASSERT_FALSE(v1.is_inline());
+    ASSERT_EQ(v1.size(), 9u);
+    v1.resize(3);
+    v1.shrink_to_fit();
+    ASSERT_TRUE(v1.is_inline());
+    ASSERT_EQ(v1[2], 2);
+}
+
+TEST(small_vector, matches_vector) {
+    sfleta_::small_vector<std::string, 2> v1{"b", "d"};
+    std::vector<std::string> v2{"b", "d"};
+    v1.insert(v1.begin(), "a");
+    v2.insert(v2.begin(), "a");
+    v1.insert(v1.begin() + 2, {"c1", "c2"});
+    v2.insert(v2.begin() + 2, {"c1", "c2"});
+    v1.emplace_back(2, 'e');
+    v2.emplace_back(2, 'e');
+    v1.erase(v1.begin() + 1);
+    v2.erase(v2.begin() + 1);
+    ASSERT_EQ(v1.size(), v2.size());
+    ASSERT_TRUE(std::equal(v1.begin(), v1.end(), v2.begin()));
+    ASSERT_EQ(v1.back(), "ee");
+}
+
+TEST(small_vector, move_inline_and_heap) {
+    sfleta_::small_vector<std::unique_ptr<int>, 2> v1;
+    v1.push_back(std::make_unique<int>(1));
+    sfleta_::small_vector<std::unique_ptr<int>, 2> v2(std::move(v1));
+    ASSERT_TRUE(v1.empty());
+    ASSERT_EQ(*v2[0], 1);
+    for (int i = 2; i <= 5; ++i) v2.push_back(std::make_unique<int>(i));
+    int* heap = &*v2[0];
+    sfleta_::small_vector<std::unique_ptr<int>, 2> v3;
+    v3 = std::move(v2);
+    ASSERT_FALSE(v3.is_inline());
+    ASSERT_EQ(&*v3[0], heap);
+    ASSERT_TRUE(v2.is_inline());
+    ASSERT_EQ(v3.size(), 5u);
+}
+
+TEST(small_vector, copy_and_swap) {
+    sfleta_::small_vector<int, 4> v1{1, 2};
+    sfleta_::small_vector<int, 4> v2{3, 4, 5, 6, 7, 8};
+    sfleta_::small_vector<int, 4> v3(v2);
+    v1.swap(v2);
+    ASSERT_EQ(v1.size(), 6u);
+    ASSERT_EQ(v2.size(), 2u);
+    ASSERT_EQ(v2[1], 2);
+    v2 = v3;
+    ASSERT_EQ(v2[5], 8);
+    ASSERT_EQ(sfleta_::erase_if(v2, [](int x) { return x % 2 == 0; }), 3u);
+    ASSERT_EQ(v2.size(), 3u);
+}
+
+TEST(small_vector, lifetimes) {
+    {
+        sfleta_::small_vector<Tracked, 3> v1;
+        for (int i = 0; i < 10; ++i) v1.push_back(Tracked(std::to_string(i)));
+        v1.erase(v1.begin(), v1.begin() + 8);
+        v1.shrink_to_fit();
+        ASSERT_EQ(Tracked::alive, 2);
+        sfleta_::small_vector<Tracked, 3> v2(std::move(v1));
+        ASSERT_EQ(Tracked::alive, 2);
+        ASSERT_EQ(v2[1].value, "9");
+    }
+    ASSERT_EQ(Tracked::alive, 0);
+}
+
+TEST(small_vector, insert_single_pass_rolls_back) {
+    sfleta_::small_vector<int, 4> v1{1, 2};
+    // fails once the elements have moved from the inline buffer to the heap
+    ASSERT_THROW(v1.insert(v1.begin(), ThrowingInput{0, 6}, ThrowingInput{10, 0}), std::runtime_error);
+    ASSERT_EQ(v1.size(), 2u);
+    ASSERT_EQ(v1[0], 1);
+    ASSERT_EQ(v1[1], 2);
+    v1.insert(v1.begin() + 1, ThrowingInput{5, -1}, ThrowingInput{8, -1});
+    std::vector<int> expected{1, 5, 6, 7, 2};
+    ASSERT_EQ(v1.size(), expected.size());
+    ASSERT_TRUE(std::equal(v1.begin(), v1.end(), expected.begin()));
+}
+
+TEST(static_vector, matches_vector) {
+    sfleta_::static_vector<std::string, 8> v1{"b", "d"};
+    std::vector<std::string> v2{"b", "d"};
+    v1.insert(v1.begin(), "a");
+    v2.insert(v2.begin(), "a");
+    v1.insert(v1.begin() + 2, {"c1", "c2"});
+    v2.insert(v2.begin() + 2, {"c1", "c2"});
+    v1.emplace_back(2, 'e');
+    v2.emplace_back(2, 'e');
+    v1.insert(v1.begin() + 1, v1[4]);
+    v2.insert(v2.begin() + 1, v2[4]);
+    v1.erase(v1.begin() + 2);
+    v2.erase(v2.begin() + 2);
+    ASSERT_EQ(v1.size(), v2.size());
+    ASSERT_TRUE(std::equal(v1.begin(), v1.end(), v2.begin()));
+    ASSERT_EQ(v1.back(), "ee");
+    ASSERT_EQ(sfleta_::erase(v1, "c1"), 1u);
+    ASSERT_EQ(v1.size(), 5u);
+}
+
+TEST(static_vector, inline_storage) {
+    using vec = sfleta_::static_vector<int, 16>;
+    static_assert(vec::capacity() == 16 && vec::max_size() == 16);
+    ASSERT_LE(sizeof(vec), 16 * sizeof(int) + 2 * sizeof(void*));
+    vec v1(16);
+    ASSERT_TRUE(v1.full());
+    auto* begin = reinterpret_cast<const char*>(&v1);
+    auto* data = reinterpret_cast<const char*>(v1.data());
+    ASSERT_TRUE(data >= begin && data < begin + sizeof(vec));
+    vec v2(std::move(v1));
+    ASSERT_EQ(v2.size(), 16u);
+    ASSERT_TRUE(v1.empty());
+    ASSERT_NE(v1.data(), v2.data());
+}
+
+TEST(static_vector, overflow_policies) {
+    sfleta_::static_vector<int, 4> v1{1, 2, 3};
+    v1.push_back(4);
+    ASSERT_THROW(v1.push_back(5), std::length_error);
+    ASSERT_THROW(v1.insert(v1.begin(), 2, 0), std::length_error);
+    ASSERT_THROW(v1.resize(5), std::length_error);
+    std::istringstream input("7 8");
+    v1.pop_back();
+    ASSERT_THROW(v1.insert(v1.begin(), std::istream_iterator<int>(input), std::istream_iterator<int>()),
+                 std::length_error);
+    ASSERT_EQ(v1.size(), 3u);
+    ASSERT_EQ(v1[2], 3);
+    sfleta_::static_vector<int, 2, sfleta_::overflow_unchecked> v2;
+    ASSERT_NE(v2.try_emplace_back(1), nullptr);
+    ASSERT_NE(v2.try_emplace_back(2), nullptr);
+    ASSERT_EQ(v2.try_emplace_back(3), nullptr);
+    ASSERT_EQ(v2.size(), 2u);
+}
+
+TEST(static_vector, copy_swap_lifetimes) {
+    {
+        sfleta_::static_vector<Tracked, 6> v1;
+        sfleta_::static_vector<Tracked, 6> v2;
+        for (int i = 0; i < 5; ++i) v1.push_back(Tracked(std::to_string(i)));
+        v2.push_back(Tracked("x"));
+        v1.swap(v2);
+        ASSERT_EQ(Tracked::alive, 6);
+        ASSERT_EQ(v1.size(), 1u);
+        ASSERT_EQ(v2[4].value, "4");
+        v1 = v2;
+        ASSERT_EQ(Tracked::alive, 10);
+        v2 = std::move(v1);
+        ASSERT_EQ(Tracked::alive, 5);
+        v2.erase(v2.begin() + 2, v2.end());
+        ASSERT_EQ(Tracked::alive, 2);
+    }
+    ASSERT_EQ(Tracked::alive, 0);
+}
+
+template <typename F>
+void for_each_isa(F f) {
+    sfleta_::simd::isa saved = sfleta_::simd::active_isa();
+    for (int level = 0; level <= static_cast<int>(sfleta_::simd::detected_isa()); ++level) {
+        sfleta_::simd::select_isa(static_cast<sfleta_::simd::isa>(level));
+        f();
+    }
+    sfleta_::simd::select_isa(saved);
+}
+
+TEST(simd, find_count_contains) {
+    for_each_isa([] {
+        for (size_t n : {0, 1, 15, 64, 100, 1001}) {
+            sfleta_::vector<int16_t> v1;
+            std::vector<int16_t> v2;
+            for (size_t i = 0; i < n; ++i) {
+                v1.push_back(static_cast<int16_t>(i % 37));
+                v2.push_back(static_cast<int16_t>(i % 37));
+            }
+            for (int16_t value : {0, 5, 36, 40}) {
+                ASSERT_EQ(sfleta_::simd::find(v1, value) - v1.begin(), std::find(v2.begin(), v2.end(), value) - v2.begin());
+                ASSERT_EQ(sfleta_::simd::count(v1, value), static_cast<size_t>(std::count(v2.begin(), v2.end(), value)));
+                ASSERT_EQ(sfleta_::simd::contains(v1, value), std::find(v2.begin(), v2.end(), value) != v2.end());
+            }
+        }
+    });
+}
+
+TEST(simd, min_max_element) {
+    for_each_isa([] {
+        std::vector<double> v2;
+        for (int i = 0; i < 300; ++i) v2.push_back(std::sin(i) * 100);
+        v2[250] = -200;
+        v2[17] = 200;
+        v2[260] = 200;
+        sfleta_::vector<double> v1;
+        v1.assign(v2.begin(), v2.end());
+        ASSERT_EQ(sfleta_::simd::min_element(v1) - v1.begin(), 250);
+        ASSERT_EQ(sfleta_::simd::max_element(v1) - v1.begin(), 17);
+        v1[3] = v2[3] = std::nan("");
+        ASSERT_EQ(sfleta_::simd::min_element(v1) - v1.begin(), std::min_element(v2.begin(), v2.end()) - v2.begin());
+        ASSERT_EQ(sfleta_::simd::max_element(v1) - v1.begin(), std::max_element(v2.begin(), v2.end()) - v2.begin());
+        sfleta_::vector<double> empty;
+        ASSERT_EQ(sfleta_::simd::min_element(empty), empty.end());
+    });
+}
+
+TEST(simd, sum_dot) {
+    for_each_isa([] {
+        sfleta_::vector<int> v1;
+        sfleta_::vector<float> v2;
+        for (int i = 1; i <= 1000; ++i) {
+            v1.push_back(i);
+            v2.push_back(0.5f);
+        }
+        ASSERT_EQ(sfleta_::simd::sum(v1), 500500);
+        ASSERT_EQ(sfleta_::simd::dot(v1, v1), 333833500);
+        ASSERT_FLOAT_EQ(sfleta_::simd::sum(v2), 500.0f);
+        ASSERT_FLOAT_EQ(sfleta_::simd::dot(v2, v2), 250.0f);
+        sfleta_::vector<uint8_t> v3(300);
+        sfleta_::simd::fill(v3, uint8_t(1));
+        ASSERT_EQ(sfleta_::simd::sum(v3), uint8_t(300 % 256));
+        ASSERT_THROW(sfleta_::simd::dot(v1, sfleta_::vector<int>(3)), std::invalid_argument);
+    });
+}
+
+TEST(simd, fill_equal) {
+    for_each_isa([] {
+        sfleta_::array<float, 37> a1{};
+        sfleta_::simd::fill(a1, 2.5f);
+        std::array<float, 37> a2;
+        a2.fill(2.5f);
+        ASSERT_TRUE(std::equal(a1.begin(), a1.end(), a2.begin()));
+        sfleta_::array<float, 37> a3 = a1;
+        ASSERT_TRUE(sfleta_::simd::equal(a1, a3));
+        a3[36] = 0;
+        ASSERT_FALSE(sfleta_::simd::equal(a1, a3));
+        sfleta_::small_vector<long long, 4> v1{1, 2, 3};
+        sfleta_::small_vector<long long, 4> v2{1, 2};
+        ASSERT_FALSE(sfleta_::simd::equal(v1, v2));
+        v2.push_back(3);
+        ASSERT_TRUE(sfleta_::simd::equal(v1, v2));
+        ASSERT_EQ(*sfleta_::simd::max_element(v1), 3);
+    });
+}
+
+TEST(simd, bitwise_popcount) {
+    for_each_isa([] {
+        for (size_t n : {0, 1, 7, 8, 33, 300}) {
+            sfleta_::vector<uint64_t> v1;
+            sfleta_::vector<uint64_t> v2;
+            size_t bits = 0;
+            for (size_t i = 0; i < n; ++i) {
+                v1.push_back(i * 0x9e3779b97f4a7c15ull);
+                v2.push_back(~i);
+                bits += __builtin_popcountll(v1[i]);
+            }
+            ASSERT_EQ(sfleta_::simd::popcount(v1), bits);
+            sfleta_::vector<uint64_t> v3(v1);
+            sfleta_::simd::xor_assign(v3, v2);
+            for (size_t i = 0; i < n; ++i) ASSERT_EQ(v3[i], v1[i] ^ v2[i]);
+            sfleta_::simd::and_assign(v3, v1);
+            sfleta_::simd::or_assign(v3, v2);
+            for (size_t i = 0; i < n; ++i) ASSERT_EQ(v3[i], (v1[i] & ~v2[i]) | v2[i]);
+        }
+        sfleta_::vector<uint64_t> v4;
+        v4.push_back(1);
+        sfleta_::vector<uint64_t> v5;
+        ASSERT_THROW(sfleta_::simd::and_assign(v4, v5), std::invalid_argument);
+    });
+}
+
+TEST(simd, select_isa) {
+    ASSERT_LE(sfleta_::simd::active_isa(), sfleta_::simd::detected_isa());
+    ASSERT_NO_THROW(sfleta_::simd::select_isa(sfleta_::simd::isa::scalar));
+    ASSERT_EQ(sfleta_::simd::active_isa(), sfleta_::simd::isa::scalar);
+    if (sfleta_::simd::detected_isa() != sfleta_::simd::isa::avx512) {
+        ASSERT_THROW(sfleta_::simd::select_isa(sfleta_::simd::isa::avx512), std::invalid_argument);
+    }
+    sfleta_::simd::select_isa(sfleta_::simd::detected_isa());
+}
+
+TEST(huge_page_vector, large_buffer_alignment) {
+    sfleta_::huge_page_vector<int64_t> v1;
+    for (int64_t i = 0; i < 1000000; ++i) v1.push_back(i);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(v1.data()) % sfleta_::kHugePageSize, 0U);
+    int64_t total = 0;
+    for (int64_t x : v1) total += x;
+    ASSERT_EQ(total, int64_t(999999) * 1000000 / 2);
+    v1.resize(3);
+    v1.shrink_to_fit();
+    ASSERT_EQ(v1.capacity(), 3U);
+    ASSERT_EQ(v1[2], 2);
+}
+
+TEST(huge_page_vector, threshold_and_copies) {
+    sfleta_::vector<std::string, sfleta_::growth_double, alignof(std::string), sfleta_::huge_page_storage<256>> v1;
+    for (int i = 0; i < 500; ++i) v1.emplace_back(std::to_string(i));
+    sfleta_::vector<std::string, sfleta_::growth_double, alignof(std::string), sfleta_::huge_page_storage<256>> v2(v1);
+    v1.shrink_to_fit();
+    ASSERT_EQ(v1[499], "499");
+    ASSERT_EQ(v2[250], "250");
+    v2.clear();
+    v2.shrink_to_fit();
+    ASSERT_EQ(v2.data(), nullptr);
+}
+
+TEST(thread_pool, task_group_runs_all) {
+    sfleta_::thread_pool pool(3);
+    ASSERT_EQ(pool.size(), 3U);
+    std::atomic<int> done(0);
+    sfleta_::task_group group(pool);
+    for (int i = 0; i < 1000; ++i) group.run([&done] { ++done; });
+    group.wait();
+    ASSERT_EQ(done.load(), 1000);
+    group.run([] { throw std::runtime_error("task failed"); });
+    ASSERT_THROW(group.wait(), std::runtime_error);
+}
+
+TEST(parallel, sort) {
+    sfleta_::thread_pool pool(4);
+    sfleta_::parallel_options opt;
+    opt.grain = 100;
+    opt.pool = &pool;
+    for (int n : {0, 1, 99, 1000, 12345}) {
+        sfleta_::vector<int> v1;
+        std::vector<int> v2;
+        for (int i = 0; i < n; ++i) {
+            v1.push_back((i * 7919) % 1009);
+            v2.push_back((i * 7919) % 1009);
+        }
+        sfleta_::parallel::sort(v1.begin(), v1.end(), std::less<>(), opt);
+        std::sort(v2.begin(), v2.end());
+        ASSERT_TRUE(std::equal(v2.begin(), v2.end(), v1.begin()));
+        sfleta_::parallel::sort(v1.begin(), v1.end(), std::greater<>(), opt);
+        ASSERT_TRUE(std::is_sorted(v1.begin(), v1.end(), std::greater<>()));
+    }
+    sfleta_::vector<std::string> v3;
+    for (int i = 0; i < 3000; ++i) v3.push_back(std::to_string((i * 31) % 997));
+    sfleta_::parallel::sort(v3.begin(), v3.end(), std::less<>(), opt);
+    ASSERT_TRUE(std::is_sorted(v3.begin(), v3.end()));
+}
+
+TEST(parallel, transform_for_each_reduce) {
+    sfleta_::thread_pool pool(4);
+    sfleta_::parallel_options opt{64, &pool};
+    sfleta_::vector<long> v1;
+    for (long i = 1; i <= 10000; ++i) v1.push_back(i);
+    sfleta_::vector<long> v2(v1.size());
+    sfleta_::parallel::transform(v1.begin(), v1.end(), v2.begin(), [](long x) { return 2 * x; }, opt);
+    ASSERT_EQ(v2[9999], 20000);
+    sfleta_::parallel::for_each(v2.begin(), v2.end(), [](long& x) { x -= 1; }, opt);
+    ASSERT_EQ(v2[0], 1);
+    ASSERT_EQ(sfleta_::parallel::reduce(v1.begin(), v1.end(), 10L, std::plus<>(), opt), 50005010L);
+    sfleta_::array<double, 500> a1{};
+    sfleta_::parallel::for_each(a1.begin(), a1.end(), [](double& x) { x = 0.5; }, opt);
+    ASSERT_DOUBLE_EQ(sfleta_::parallel::reduce(a1.begin(), a1.end(), 0.0, std::plus<>(), opt), 250.0);
+    ASSERT_THROW(sfleta_::parallel::for_each(v1.begin(), v1.end(), [](long x) {
+        if (x == 5000) throw std::logic_error("bad element");
+    }, opt), std::logic_error);
+}
+
+TEST(parallel, inclusive_scan) {
+    sfleta_::thread_pool pool(4);
+    sfleta_::parallel_options opt{50, &pool};
+    sfleta_::vector<int> v1;
+    std::vector<int> v2;
+    for (int i = 0; i < 5000; ++i) {
+        v1.push_back(i % 13);
+        v2.push_back(i % 13);
+    }
+    sfleta_::vector<int> out(v1.size());
+    sfleta_::parallel::inclusive_scan(v1.begin(), v1.end(), out.begin(), std::plus<>(), opt);
+    std::inclusive_scan(v2.begin(), v2.end(), v2.begin());
+    ASSERT_TRUE(std::equal(v2.begin(), v2.end(), out.begin()));
+    sfleta_::parallel::inclusive_scan(v1.begin(), v1.end(), v1.begin(), std::plus<>(), opt);
+    ASSERT_TRUE(std::equal(v2.begin(), v2.end(), v1.begin()));
+}
+
+TEST(parallel, partition) {
+    sfleta_::thread_pool pool(4);
+    sfleta_::parallel_options opt{37, &pool};
+    sfleta_::vector<int> v1;
+    for (int i = 0; i < 4000; ++i) v1.push_back((i * 7919) % 4001);
+    std::vector<int> v2(v1.begin(), v1.end());
+    auto pred = [](int x) { return x % 3 == 0; };
+    auto mid = sfleta_::parallel::partition(v1.begin(), v1.end(), pred, opt);
+    ASSERT_TRUE(std::is_partitioned(v1.begin(), v1.end(), pred));
+    ASSERT_EQ(mid - v1.begin(), std::count_if(v2.begin(), v2.end(), pred));
+    std::vector<int> v3(v1.begin(), v1.end());
+    std::sort(v2.begin(), v2.end());
+    std::sort(v3.begin(), v3.end());
+    ASSERT_EQ(v2, v3);
+}
+
+TEST(radix_sort, integers) {
+    for (unsigned bits : {8u, 11u, 16u}) {
+        sfleta_::radix_options opt;
+        opt.digit_bits = bits;
+        sfleta_::vector<int> v1;
+        sfleta_::vector<uint64_t> v2;
+        std::vector<int> v3;
+        std::vector<uint64_t> v4;
+        for (int i = 0; i < 5000; ++i) {
+            int x = (i * 7919) % 10007 - 5000;
+            uint64_t y = uint64_t(i) * 0x9E3779B97F4A7C15ULL;
+            v1.push_back(x);
+            v3.push_back(x);
+            v2.push_back(y);
+            v4.push_back(y);
+        }
+        sfleta_::radix_sort(v1, opt);
+        sfleta_::radix_sort(v2, opt);
+        std::sort(v3.begin(), v3.end());
+        std::sort(v4.begin(), v4.end());
+        ASSERT_TRUE(std::equal(v3.begin(), v3.end(), v1.begin()));
+        ASSERT_TRUE(std::equal(v4.begin(), v4.end(), v2.begin()));
+    }
+}
+
+TEST(radix_sort, floats) {
+    sfleta_::vector<double> v1;
+    std::vector<double> v2;
+    for (int i = 0; i < 3000; ++i) {
+        double x = std::sin(i) * std::pow(10.0, i % 20 - 10);
+        v1.push_back(x);
+        v2.push_back(x);
+    }
+    v1.push_back(-std::numeric_limits<double>::infinity());
+    v2.push_back(-std::numeric_limits<double>::infinity());
+    sfleta_::radix_sort(v1);
+    std::sort(v2.begin(), v2.end());
+    ASSERT_TRUE(std::equal(v2.begin(), v2.end(), v1.begin()));
+    sfleta_::array<float, 4> a1{0.0f, -0.0f, -2.5f, 1.0f};
+    sfleta_::radix_sort(a1);
+    ASSERT_EQ(a1[0], -2.5f);
+    ASSERT_TRUE(std::signbit(a1[1]));
+    ASSERT_FALSE(std::signbit(a1[2]));
+}
+
+TEST(radix_sort, records_by_key_stable) {
+    struct record {
+        uint64_t key;
+        int order;
+    };
+    sfleta_::vector<record> v1;
+    for (int i = 0; i < 4000; ++i) v1.push_back(record{uint64_t((i * 31) % 97) << 40, i});
+    sfleta_::radix_options opt;
+    opt.digit_bits = 11;
+    sfleta_::radix_sort(v1, [](const record& r) { return r.key; }, opt);
+    for (size_t i = 1; i < v1.size(); ++i) {
+        ASSERT_TRUE(v1[i - 1].key < v1[i].key || (v1[i - 1].key == v1[i].key && v1[i - 1].order < v1[i].order));
+    }
+}
+
+TEST(radix_sort, parallel_histogram_and_options) {
+    sfleta_::thread_pool pool(3);
+    sfleta_::radix_options opt;
+    opt.parallel_histogram = true;
+    opt.parallel.grain = 100;
+    opt.parallel.pool = &pool;
+    sfleta_::vector<int64_t> v1;
+    for (int64_t i = 0; i < 10000; ++i) v1.push_back((i * 104729) % 20011 - 10000);
+    std::vector<int64_t> v2(v1.begin(), v1.end());
+    sfleta_::radix_sort(v1, opt);
+    std::sort(v2.begin(), v2.end());
+    ASSERT_TRUE(std::equal(v2.begin(), v2.end(), v1.begin()));
+    opt.digit_bits = 17;
+    ASSERT_THROW(sfleta_::radix_sort(v1, opt), std::invalid_argument);
+}
+
+TEST(soa_vector, push_and_rows) {
+    sfleta_::soa_vector<int, double, std::string> v1;
+    for (int i = 0; i < 1000; ++i) v1.push_back(i, i * 0.5, std::to_string(i));
+    ASSERT_EQ(v1.size(), 1000u);
+    ASSERT_GE(v1.capacity(), 1000u);
+    auto [id, weight, name] = v1[42];
+    ASSERT_EQ(id, 42);
+    ASSERT_EQ(weight, 21.0);
+    ASSERT_EQ(name, "42");
+    id = -1;
+    ASSERT_EQ(std::get<0>(v1[42]), -1);
+    v1[7] = std::make_tuple(70, 7.5, std::string("seven"));
+    ASSERT_EQ(std::get<2>(v1.at(7)), "seven");
+    ASSERT_THROW(v1.at(1000), std::out_of_range);
+    // arguments that point into the columns survive the reallocation
+    v1.shrink_to_fit();
+    v1.emplace_back(std::get<0>(v1[3]), std::get<1>(v1[3]), std::get<2>(v1[3]));
+    ASSERT_EQ(std::get<2>(v1[1000]), "3");
+    int rows = 0;
+    for (auto row : v1) rows += std::get<0>(row) == 3;
+    ASSERT_EQ(rows, 2);
+    auto first = v1.begin();
+    auto last = 3 + first;
+    ASSERT_TRUE(last > first && first <= last && last >= first + 3 && !(first >= last));
+    ASSERT_EQ(std::get<0>(*last), 3);
+}
+
+TEST(soa_vector, columns) {
+    sfleta_::soa_vector<uint8_t, float, int64_t> v1(100);
+    ASSERT_EQ(v1.size(), 100u);
+    auto weights = v1.column<1>();
+    ASSERT_EQ(weights.size(), 100u);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(weights.data()) % 64, 0u);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(v1.data<0>()) % 64, 0u);
+    for (size_t i = 0; i < weights.size(); ++i) weights[i] = float(i);
+    auto counts = v1.column<2>();
+    sfleta_::simd::fill(counts, int64_t(3));
+    ASSERT_FLOAT_EQ(sfleta_::simd::sum(v1.column<1>()), 4950.0f);
+    ASSERT_EQ(sfleta_::simd::sum(v1.column<2>()), 300);
+    const auto& v2 = v1;
+    ASSERT_EQ(std::count(v2.column<0>().begin(), v2.column<0>().end(), 0), 100);
+    ASSERT_EQ(std::get<1>(v2[99]), 99.0f);
+}
+
+TEST(soa_vector, resize_pop_clear) {
+    sfleta_::soa_vector<std::string, std::unique_ptr<int>> v1;
+    v1.emplace_back("a", std::make_unique<int>(1));
+    v1.resize(50);
+    ASSERT_EQ(*std::get<1>(v1[0]), 1);
+    ASSERT_EQ(std::get<1>(v1[49]), nullptr);
+    v1.pop_back();
+    ASSERT_EQ(v1.size(), 49u);
+    v1.resize(1);
+    ASSERT_EQ(std::get<0>(v1[0]), "a");
+    size_t capacity = v1.capacity();
+    v1.clear();
+    ASSERT_TRUE(v1.empty());
+    ASSERT_EQ(v1.capacity(), capacity);
+    v1.shrink_to_fit();
+    ASSERT_EQ(v1.capacity(), 0u);
+}
+
+TEST(soa_vector, copy_move_swap) {
+    sfleta_::soa_vector<int, std::string> v1;
+    for (int i = 0; i < 20; ++i) v1.push_back(i, std::string(i, 'x'));
+    sfleta_::soa_vector<int, std::string> v2(v1);
+    ASSERT_EQ(v2.size(), 20u);
+    ASSERT_EQ(std::get<1>(v2[19]), std::string(19, 'x'));
+    sfleta_::soa_vector<int, std::string> v3(std::move(v1));
+    ASSERT_TRUE(v1.empty());
+    ASSERT_EQ(v1.capacity(), 0u);
+    v1.push_back(1, "one");
+    v1 = v3;
+    ASSERT_EQ(std::get<0>(v1[5]), 5);
+    v3 = std::move(v2);
+    ASSERT_EQ(std::get<1>(v3[2]), "xx");
+    v1.swap(v2);
+    ASSERT_EQ(v2.size(), 20u);
+    ASSERT_TRUE(v1.empty());
+}
+
+TEST(soa_vector, sort_and_reverse_rows) {
+    sfleta_::soa_vector<int, std::string> v1;
+    for (int i = 0; i < 500; ++i) v1.push_back((i * 7919) % 500, std::to_string(i));
+    std::sort(v1.begin(), v1.end(),
+              [](const auto& a, const auto& b) { return std::get<0>(a) < std::get<0>(b); });
+    for (int i = 0; i < 500; ++i) {
+        ASSERT_EQ(std::get<0>(v1[i]), i);
+        // the other column moved with its key
+        ASSERT_EQ((std::stoi(std::get<1>(v1[i])) * 7919) % 500, i);
+    }
+    std::reverse(v1.begin(), v1.end());
+    ASSERT_EQ(std::get<0>(v1[0]), 499);
+    ASSERT_EQ(std::get<0>(v1[499]), 0);
+    // a row copies out to a value and assigns back from one
+    sfleta_::soa_vector<int, std::string>::value_type row = v1[0];
+    v1[0] = v1[499];
+    ASSERT_EQ(std::get<0>(v1[0]), 0);
+    ASSERT_EQ(std::get<0>(row), 499);
+    v1[499] = row;
+    ASSERT_EQ(std::get<0>(v1[499]), 499);
+    ASSERT_EQ(std::get<1>(v1[499]), std::get<1>(row));
+    swap(v1[0], v1[499]);
+    ASSERT_EQ(std::get<0>(v1[0]), 499);
+    ASSERT_EQ(std::get<0>(v1[499]), 0);
+}
+
+TEST(deque, push_pop_both_ends) {
+    sfleta_::deque<int> d1;
+    std::deque<int> d2;
+    for (int i = 1; i < 5000; ++i) {
+        if (i % 3 == 0) {
+            d1.push_front(i);
+            d2.push_front(i);
+        } else {
+            d1.push_back(i);
+            d2.push_back(i);
+        }
+        if (i % 7 == 0) {
+            d1.pop_back();
+            d2.pop_back();
+        }
+        if (i % 11 == 0) {
+            d1.pop_front();
+            d2.pop_front();
+        }
+    }
+    ASSERT_EQ(d1.size(), d2.size());
+    ASSERT_TRUE(std::equal(d1.begin(), d1.end(), d2.begin(), d2.end()));
+    for (size_t i = 0; i < d2.size(); i += 97) ASSERT_EQ(d1[i], d2[i]);
+    ASSERT_EQ(d1.front(), d2.front());
+    ASSERT_EQ(d1.back(), d2.back());
+    ASSERT_THROW(d1.at(d1.size()), std::out_of_range);
+    d1.clear();
+    ASSERT_TRUE(d1.empty());
+    ASSERT_THROW(d1.pop_front(), std::range_error);
+    ASSERT_THROW(d1.back(), std::range_error);
+    // a FIFO walks through the map and keeps recentring it
+    for (int i = 0; i < 100; ++i) d1.push_back(i);
+    for (int i = 100; i < 100000; ++i) {
+        ASSERT_EQ(d1.front(), i - 100);
+        d1.pop_front();
+        d1.push_back(i);
+    }
+    ASSERT_EQ(d1.size(), 100u);
+    ASSERT_EQ(d1.back(), 99999);
+}
+
+TEST(deque, stable_references) {
+    sfleta_::deque<std::string> d1{"a", "b", "c"};
+    std::string& b = d1[1];
+    for (int i = 0; i < 10000; ++i) {
+        d1.push_back(std::to_string(i));
+        d1.push_front(std::to_string(-i));
+    }
+    ASSERT_EQ(&b, &d1[10001]);
+    ASSERT_EQ(b, "b");
+    // the argument refers into the deque while it grows
+    for (int i = 0; i < 1000; ++i) d1.push_back(d1.front());
+    ASSERT_EQ(d1.back(), "-9999");
+    d1.shrink_to_fit();
+    ASSERT_EQ(b, "b");
+}
+
+TEST(deque, iterators_and_algorithms) {
+    sfleta_::deque<int> d1(1000);
+    ASSERT_EQ(d1.size(), 1000u);
+    std::iota(d1.begin(), d1.end(), 0);
+    std::reverse(d1.begin(), d1.end());
+    ASSERT_EQ(d1[0], 999);
+    std::sort(d1.begin(), d1.end());
+    ASSERT_EQ(d1.end() - d1.begin(), 1000);
+    ASSERT_EQ(*std::lower_bound(d1.cbegin(), d1.cend(), 500), 500);
+    sfleta_::deque<int>::const_iterator it = d1.begin() + 10;
+    ASSERT_EQ(it[5], 15);
+    ASSERT_EQ(*(5 + it), 15);
+    ASSERT_TRUE(5 + it == it + 5);
+    d1.resize(10);
+    ASSERT_EQ(std::accumulate(d1.begin(), d1.end(), 0), 45);
+}
+
+TEST(deque, copy_move_swap) {
+    sfleta_::deque<std::unique_ptr<int>> d1;
+    for (int i = 0; i < 300; ++i) d1.emplace_front(std::make_unique<int>(i));
+    sfleta_::deque<std::unique_ptr<int>> d2(std::move(d1));
+    ASSERT_TRUE(d1.empty());
+    ASSERT_EQ(*d2.front(), 299);
+    d1.emplace_back(std::make_unique<int>(-1));
+    d1.swap(d2);
+    ASSERT_EQ(d1.size(), 300u);
+    ASSERT_EQ(*d2.back(), -1);
+    d2 = std::move(d1);
+    ASSERT_EQ(*d2.back(), 0);
+    sfleta_::deque<std::string> d3{"x", "y"};
+    sfleta_::deque<std::string> d4;
+    d4 = d3;
+    d3.pop_front();
+    ASSERT_EQ(d4.size(), 2u);
+    ASSERT_EQ(d4.front(), "x");
+}
+
+TEST(dynamic_bitset, bits_and_proxies) {
+    sfleta_::dynamic_bitset b1(130);
+    ASSERT_EQ(b1.size(), 130u);
+    ASSERT_EQ(b1.num_words(), 3u);
+    ASSERT_TRUE(b1.none());
+    b1[0] = true;
+    b1[64] = b1[0];
+    b1.set(129);
+    b1[5].flip();
+    ASSERT_TRUE(b1.test(5));
+    ASSERT_FALSE(~b1[5]);
+    ASSERT_EQ(b1.count(), 4u);
+    b1.reset(5);
+    ASSERT_FALSE(b1[5]);
+    ASSERT_THROW(b1.test(130), std::out_of_range);
+    ASSERT_THROW(b1.set(200), std::out_of_range);
+    b1.set();
+    ASSERT_TRUE(b1.all());
+    ASSERT_EQ(b1.count(), 130u);
+    b1.flip();
+    ASSERT_TRUE(b1.none());
+}
+
+TEST(dynamic_bitset, find_first_next) {
+    sfleta_::dynamic_bitset b1(1000);
+    ASSERT_EQ(b1.find_first(), sfleta_::dynamic_bitset::npos);
+    std::vector<size_t> positions{3, 63, 64, 65, 500, 999};
+    for (size_t pos : positions) b1.set(pos);
+    std::vector<size_t> found;
+    for (size_t pos = b1.find_first(); pos != sfleta_::dynamic_bitset::npos; pos = b1.find_next(pos)) {
+        found.push_back(pos);
+    }
+    ASSERT_EQ(found, positions);
+    ASSERT_EQ(b1.find_next(999), sfleta_::dynamic_bitset::npos);
+}
+
+TEST(dynamic_bitset, resize_push_pop) {
+    sfleta_::dynamic_bitset b1;
+    std::vector<bool> b2;
+    for (int i = 0; i < 200; ++i) {
+        b1.push_back(i % 3 == 0);
+        b2.push_back(i % 3 == 0);
+    }
+    b1.resize(250, true);
+    b2.resize(250, true);
+    b1.resize(140);
+    b2.resize(140);
+    b1.pop_back();
+    b2.pop_back();
+    ASSERT_EQ(b1.size(), b2.size());
+    for (size_t i = 0; i < b2.size(); ++i) ASSERT_EQ(b1[i], b2[i]);
+    ASSERT_EQ(b1.count(), static_cast<size_t>(std::count(b2.begin(), b2.end(), true)));
+    b1.resize(192, true);
+    ASSERT_TRUE(b1[191] && b1[139]);
+    ASSERT_EQ(sfleta_::dynamic_bitset(70, true).count(), 70u);
+    b1.clear();
+    ASSERT_TRUE(b1.empty());
+}
+
+TEST(dynamic_bitset, bulk_operators) {
+    for_each_isa([] {
+        sfleta_::dynamic_bitset b1(1000);
+        sfleta_::dynamic_bitset b2(1000);
+        for (size_t i = 0; i < 1000; i += 2) b1.set(i);
+        for (size_t i = 0; i < 1000; i += 3) b2.set(i);
+        ASSERT_EQ((b1 & b2).count(), 167u);
+        ASSERT_EQ((b1 | b2).count(), 667u);
+        ASSERT_EQ((b1 ^ b2).count(), 500u);
+        sfleta_::dynamic_bitset b3 = ~b1;
+        ASSERT_EQ(b3.count(), 500u);
+        ASSERT_EQ(b3.find_first(), 1u);
+        b3 |= b1;
+        ASSERT_TRUE(b3.all());
+        ASSERT_TRUE((b1 ^ b1).none());
+        ASSERT_TRUE(b1 == sfleta_::dynamic_bitset(b1));
+        ASSERT_TRUE(b1 != b2);
+        ASSERT_THROW(b1 &= sfleta_::dynamic_bitset(999), std::invalid_argument);
+    });
+}
+
+std::string temp_path(const std::string& name) {
+    std::string path = ::testing::TempDir() + "sfleta_" + name + "_" + std::to_string(::getpid());
+    std::remove(path.c_str());
+    return path;
+}
+
+TEST(mmap_vector, push_and_reopen) {
+    std::string path = temp_path("push_and_reopen");
+    {
+        sfleta_::mmap_vector<double> v1(path, sfleta_::open_mode::create);
+        ASSERT_TRUE(v1.empty());
+        for (int i = 0; i < 10000; ++i) v1.push_back(i * 0.5);
+        ASSERT_EQ(v1.size(), 10000U);
+        ASSERT_GE(v1.capacity(), 10000U);
+        v1.sync();
+    }
+    struct stat st;
+    ASSERT_EQ(::stat(path.c_str(), &st), 0);
+    ASSERT_EQ(static_cast<size_t>(st.st_size), sfleta_::mmap_vector<double>::header_size() + 10000 * sizeof(double));
+    sfleta_::mmap_vector<double> v2(path, sfleta_::open_mode::read_only);
+    ASSERT_EQ(v2.size(), 10000U);
+    double total = 0;
+    for (double x : v2) total += x;
+    ASSERT_DOUBLE_EQ(total, 0.5 * 9999 * 10000 / 2);
+    ASSERT_DOUBLE_EQ(v2[9999], 4999.5);
+    std::remove(path.c_str());
+}
+
+TEST(mmap_vector, reserve_resize_append) {
+    std::string path = temp_path("reserve_resize");
+    {
+        sfleta_::mmap_vector<int> v1(path, sfleta_::open_mode::create);
+        v1.reserve(100);
+        ASSERT_EQ(v1.capacity(), 100U);
+        v1.resize(10, 7);
+        v1.emplace_back(8);
+        v1.pop_back();
+        v1.shrink_to_fit();
+        ASSERT_EQ(v1.capacity(), 10U);
+    }
+    {
+        sfleta_::mmap_vector<int> v2(path);
+        ASSERT_EQ(v2.size(), 10U);
+        v2.push_back(v2[0]);
+        ASSERT_EQ(v2[10], 7);
+    }
+    sfleta_::mmap_vector<int> v3(path, sfleta_::open_mode::read_only);
+    ASSERT_EQ(v3.size(), 11U);
+    std::remove(path.c_str());
+}
+
+TEST(mmap_vector, read_only_and_errors) {
+    std::string path = temp_path("read_only");
+    ASSERT_THROW(sfleta_::mmap_vector<int>(path, sfleta_::open_mode::read_only), std::system_error);
+    {
+        sfleta_::mmap_vector<char> v1(path, sfleta_::open_mode::create);
+        v1.resize(6, 'x');
+    }
+    try {
+        sfleta_::mmap_vector<int> v1(path, sfleta_::open_mode::read_only);
+        FAIL() << "a file of chars must not open as ints";
+    } catch (const std::system_error&) {
+        FAIL() << "size mismatch reported as a system error";
+    } catch (const std::runtime_error& e) {
+        ASSERT_STREQ(e.what(), "error sfleta_mmap_vector: file element size does not match");
+    }
+    std::string raw = temp_path("read_only_raw");
+    {
+        std::ofstream out(raw);
+        out << "not a vector";
+    }
+    ASSERT_THROW(sfleta_::mmap_vector<char>(raw, sfleta_::open_mode::read_only), std::runtime_error);
+    std::remove(raw.c_str());
+    {
+        sfleta_::mmap_vector<char> v2(path, sfleta_::open_mode::read_only);
+        ASSERT_TRUE(v2.read_only());
+        ASSERT_THROW(v2.push_back('y'), std::logic_error);
+        ASSERT_THROW(v2.reserve(100), std::logic_error);
+        ASSERT_EQ(v2[5], 'x');
+        // stores land in a private copy of the page
+        v2[0] = 'z';
+        *v2.begin() = 'z';
+        ASSERT_EQ(v2.data()[0], 'z');
+    }
+    sfleta_::mmap_vector<char> v3(path, sfleta_::open_mode::read_only);
+    ASSERT_EQ(v3[0], 'x');
+    std::remove(path.c_str());
+}
+
+TEST(mmap_vector, read_only_larger_than_memory) {
+    std::string path = temp_path("sparse");
+    {
+        sfleta_::mmap_vector<uint64_t> v1(path, sfleta_::open_mode::create);
+        v1.push_back(7);
+    }
+    // a sparse file twice the size of physical memory
+    off_t bytes = static_cast<off_t>(::sysconf(_SC_PHYS_PAGES)) * ::sysconf(_SC_PAGE_SIZE) * 2;
+    ASSERT_EQ(::truncate(path.c_str(), bytes), 0);
+    {
+        sfleta_::mmap_vector<uint64_t> v2(path, sfleta_::open_mode::read_only);
+        ASSERT_EQ(v2.size(), 1U);
+        ASSERT_EQ(v2.capacity(), (static_cast<size_t>(bytes) - v2.header_size()) / sizeof(uint64_t));
+        ASSERT_EQ(v2[0], 7U);
+        ASSERT_EQ(v2.data()[v2.capacity() - 1], 0U);
+        v2.data()[1] = 9;
+        ASSERT_EQ(v2.data()[1], 9U);
+    }
+    std::remove(path.c_str());
+}
+
+TEST(mmap_vector, crash_after_sync) {
+    std::string path = temp_path("crash_after_sync");
+    pid_t pid = ::fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        // the child dies without running destructors, as after a crash
+        sfleta_::mmap_vector<int> v1(path, sfleta_::open_mode::create);
+        for (int i = 1; i <= 5; ++i) v1.push_back(i);
+        v1.sync();
+        v1.push_back(6);
+        ::_exit(0);
+    }
+    int status = 0;
+    ASSERT_EQ(::waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFEXITED(status));
+    sfleta_::mmap_vector<int> v2(path, sfleta_::open_mode::read_only);
+    ASSERT_EQ(v2.size(), 5U);
+    ASSERT_GE(v2.capacity(), 6U);
+    for (int i = 0; i < 5; ++i) ASSERT_EQ(v2[i], i + 1);
+    std::remove(path.c_str());
+}
+
+TEST(mmap_vector, move) {
+    std::string path = temp_path("move");
+    sfleta_::mmap_vector<int> v1(path, sfleta_::open_mode::create);
+    v1.push_back(1);
+    sfleta_::mmap_vector<int> v2(std::move(v1));
+    ASSERT_EQ(v1.size(), 0U);
+    ASSERT_EQ(v2.size(), 1U);
+    v2.push_back(2);
+    sfleta_::mmap_vector<int> v3(temp_path("move_other"), sfleta_::open_mode::create);
+    v3 = std::move(v2);
+    ASSERT_EQ(v3[1], 2);
+    std::remove(path.c_str());
+    std::remove(temp_path("move_other").c_str());
+}
+
 TEST(map_initialization, default_costruct) {
     sfleta_::Map<int, double> s1;
     std::map<int, double> s2;
@@ -3175,7 +5073,10 @@ TEST(map_iterators, iterator3) {
 
 TEST(map_iterators, emplace) {
     sfleta_::Map<double, double> s1;
-    s1.emplace(17.3, 5.5, 41.5, -3.8, 94., 13.7, -124.3, 9.1);
+    s1.emplace(17.3, 5.5);
+    s1.emplace(41.5, -3.8);
+    s1.emplace(94., 13.7);
+    s1.emplace(-124.3, 9.1);
     ASSERT_EQ(s1[17.3], 5.5);
     ASSERT_EQ(s1[41.5], -3.8);
     ASSERT_EQ(s1[94.], 13.7);
@@ -3183,6 +5084,18 @@ TEST(map_iterators, emplace) {
     ASSERT_EQ(s1.size(), 4);
 }
 
+TEST(map_iterators, emplace_result) {
+    sfleta_::Map<std::string, std::string> s1;
+    auto res = s1.emplace("key", std::string(4, 'v'));
+    ASSERT_TRUE(res.second);
+    ASSERT_EQ(s1["key"], "vvvv");
+    res = s1.emplace(std::make_pair(std::string("key"), std::string("other")));
+    ASSERT_FALSE(res.second);
+    ASSERT_EQ(s1["key"], "vvvv");
+    ASSERT_TRUE(s1.insert(std::make_pair(std::string("k2"), std::string("w"))).second);
+    ASSERT_EQ(s1.size(), 2u);
+}
+
 TEST(queue_constructor, default_constr) {
     sfleta_::Queue<double> q1;
     ASSERT_EQ(q1.size(), 0);
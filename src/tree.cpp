@@ -3,45 +3,48 @@
 #include <iostream>
 namespace sfleta_ {
 
-template <typename K, typename T>
-Tree<K, T>::Tree(const std::initializer_list<K> &items) : Tree() {
+template <typename K, typename T, typename Update>
+Tree<K, T, Update>::Tree(const std::initializer_list<K> &items) : Tree() {
     for (auto &value : items) insert(value);
 }
 
-template <typename K, typename T>
-Tree<K, T>::Tree(const Tree<K, T> &t) : Tree<K, T>() {
+template <typename K, typename T, typename Update>
+Tree<K, T, Update>::Tree(const Tree<K, T, Update> &t) : Tree<K, T, Update>() {
     for (auto &&value : t) insert(value);
 }
 
-template <typename K, typename T>
-Tree<K, T>::~Tree() {
+template <typename K, typename T, typename Update>
+Tree<K, T, Update>::~Tree() {
     clear();
 }
 
-template <typename K, typename T>
-typename Tree<K, T>::Iterator Tree<K, T>::insert(const K& value) {
-    Tree<K, T>::Iterator it;
+template <typename K, typename T, typename Update>
+template <typename V>
+typename Tree<K, T, Update>::Iterator Tree<K, T, Update>::InsertKey(V&& value) {
+    Tree<K, T, Update>::Iterator it;
     if (root_ == nullptr) {
         root_ = new TreeNode<K, T>();
-        root_->data_->first = value;
+        root_->data_->first = std::forward<V>(value);
         root_->color_ = kBlack;
         nil_ = new TreeNode<K, T>();
         nil_->p_parent_ = root_;
         root_->p_right_ = nil_;
+        UpdateNode(root_);
         it.node_ = root_;
     } else {
         if (size() == max_size()) {
         throw std::overflow_error("ERROR: Container is overflow!");
         }
-        it = FindPlace(value);
+        it = FindPlace(std::forward<V>(value));
     }
     size_++;
     return it;
 }
 
-template <typename K, typename T>
-typename Tree<K, T>::Iterator Tree<K, T>::FindPlace(const K& value) {
-    Tree<K, T>::Iterator it;
+template <typename K, typename T, typename Update>
+template <typename V>
+typename Tree<K, T, Update>::Iterator Tree<K, T, Update>::FindPlace(V&& value) {
+    Tree<K, T, Update>::Iterator it;
     TreeNode<K, T>* tmp = root_;
     while (tmp != nullptr) {
         if (value >= tmp->data_->first) {
@@ -53,8 +56,9 @@ typename Tree<K, T>::Iterator Tree<K, T>::FindPlace(const K& value) {
                 }
                 tmp->p_right_ = new_node;
                 new_node->p_parent_ = tmp;
-                new_node->data_->first = value;
+                new_node->data_->first = std::forward<V>(value);
                 new_node->color_ = kRed;
+                UpdatePath(new_node);
                 InsertCase2(new_node);
                 it.node_ = new_node;
                 return it;
@@ -66,8 +70,9 @@ typename Tree<K, T>::Iterator Tree<K, T>::FindPlace(const K& value) {
                 TreeNode<K, T>* new_node = new TreeNode<K, T>();
                 tmp->p_left_ = new_node;
                 new_node->p_parent_ = tmp;
-                new_node->data_->first = value;
+                new_node->data_->first = std::forward<V>(value);
                 new_node->color_ = kRed;
+                UpdatePath(new_node);
                 InsertCase2(new_node);
                 it.node_ = new_node;
                 return it;
@@ -79,8 +84,8 @@ typename Tree<K, T>::Iterator Tree<K, T>::FindPlace(const K& value) {
     return it;
 }
 
-template <typename K, typename T>
-TreeNode<K, T>* Tree<K, T>::Grandpa(TreeNode<K, T>* node) const {
+template <typename K, typename T, typename Update>
+TreeNode<K, T>* Tree<K, T, Update>::Grandpa(TreeNode<K, T>* node) const {
     if (node && node->p_parent_) {
         return node->p_parent_->p_parent_;
     } else {
@@ -88,8 +93,8 @@ TreeNode<K, T>* Tree<K, T>::Grandpa(TreeNode<K, T>* node) const {
     }
 }
 
-template <typename K, typename T>
-TreeNode<K, T>* Tree<K, T>::Uncle(TreeNode<K, T>* node) const {
+template <typename K, typename T, typename Update>
+TreeNode<K, T>* Tree<K, T, Update>::Uncle(TreeNode<K, T>* node) const {
     TreeNode<K, T>* grandpa = Grandpa(node);
     if (grandpa == nullptr) {
         return nullptr;
@@ -101,8 +106,8 @@ TreeNode<K, T>* Tree<K, T>::Uncle(TreeNode<K, T>* node) const {
     }
 }
 
-template <typename K, typename T>
-TreeNode<K, T>* Tree<K, T>::Brother(TreeNode<K, T>* node) const {
+template <typename K, typename T, typename Update>
+TreeNode<K, T>* Tree<K, T, Update>::Brother(TreeNode<K, T>* node) const {
     if (node == node->p_parent_->p_left_ && node->p_parent_->p_right_)
         return node->p_parent_->p_right_;
     else if (node->p_parent_->p_left_)
@@ -110,8 +115,8 @@ TreeNode<K, T>* Tree<K, T>::Brother(TreeNode<K, T>* node) const {
     return node;
 }
 
-template <typename K, typename T>
-void Tree<K, T>::RotateLeft(TreeNode<K, T>* node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::RotateLeft(TreeNode<K, T>* node) {
     TreeNode<K, T>* pivot = node->p_right_;
     pivot->p_parent_ = node->p_parent_;
     if (node->p_parent_) {
@@ -127,14 +132,16 @@ void Tree<K, T>::RotateLeft(TreeNode<K, T>* node) {
     }
     node->p_parent_ = pivot;
     pivot->p_left_ = node;
+    UpdateNode(node);
+    UpdateNode(pivot);
     if (pivot->p_parent_ == nullptr) {
         root_ = pivot;
         InsertCase1(root_);
     }
 }
 
-template <typename K, typename T>
-void Tree<K, T>::RotateRight(TreeNode<K, T>* node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::RotateRight(TreeNode<K, T>* node) {
     TreeNode<K, T>* pivot = node->p_left_;
     pivot->p_parent_ = node->p_parent_;
     if (node->p_parent_) {
@@ -150,14 +157,16 @@ void Tree<K, T>::RotateRight(TreeNode<K, T>* node) {
     }
     node->p_parent_ = pivot;
     pivot->p_right_ = node;
+    UpdateNode(node);
+    UpdateNode(pivot);
     if (pivot->p_parent_ == nullptr) {
         root_ = pivot;
         InsertCase1(root_);
     }
 }
 
-template <typename K, typename T>
-void Tree<K, T>::InsertCase1(TreeNode<K, T>* node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::InsertCase1(TreeNode<K, T>* node) {
     if (node->p_parent_ == nullptr) {
         node->color_ = kBlack;
     } else {
@@ -165,8 +174,8 @@ void Tree<K, T>::InsertCase1(TreeNode<K, T>* node) {
     }
 }
 
-template <typename K, typename T>
-void Tree<K, T>::InsertCase2(TreeNode<K, T>* node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::InsertCase2(TreeNode<K, T>* node) {
     if (node->p_parent_->color_ == kBlack) {
         return;
     } else {
@@ -174,8 +183,8 @@ void Tree<K, T>::InsertCase2(TreeNode<K, T>* node) {
     }
 }
 
-template <typename K, typename T>
-void Tree<K, T>::InsertCase3(TreeNode<K, T> *node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::InsertCase3(TreeNode<K, T> *node) {
     TreeNode<K, T> *uncle = Uncle(node);
     if (uncle && uncle->color_ == kRed) {
         node->p_parent_->color_ = kBlack;
@@ -188,8 +197,8 @@ void Tree<K, T>::InsertCase3(TreeNode<K, T> *node) {
     }
 }
 
-template <typename K, typename T>
-void Tree<K, T>::InsertCase4(TreeNode<K, T>* node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::InsertCase4(TreeNode<K, T>* node) {
     TreeNode<K, T>* grandpa = Grandpa(node);
     if (node == node->p_parent_->p_right_ && node->p_parent_ == grandpa->p_left_) {
         RotateLeft(node->p_parent_);
@@ -201,8 +210,8 @@ void Tree<K, T>::InsertCase4(TreeNode<K, T>* node) {
     InsertCase5(node);
 }
 
-template <typename K, typename T>
-void Tree<K, T>::InsertCase5(TreeNode<K, T>* node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::InsertCase5(TreeNode<K, T>* node) {
     TreeNode<K, T>* grandpa = Grandpa(node);
     node->p_parent_->color_ = kBlack;
     grandpa->color_ = kRed;
@@ -213,14 +222,14 @@ void Tree<K, T>::InsertCase5(TreeNode<K, T>* node) {
     }
 }
 
-template <typename K, typename T>
-TreeNode<K, T>* Tree<K, T>::next_elem(TreeNode<K, T>* root) const {
+template <typename K, typename T, typename Update>
+TreeNode<K, T>* Tree<K, T, Update>::next_elem(TreeNode<K, T>* root) const {
     if (root->p_right_) return next_elem(root->p_right_);
     return root == nil_ ? root->p_parent_ : root;
 }
 
-template <typename K, typename T>
-int Tree<K, T>::number_of_child(TreeNode<K, T> *root) const {
+template <typename K, typename T, typename Update>
+int Tree<K, T, Update>::number_of_child(TreeNode<K, T> *root) const {
   if ((!root->p_left_) && (!root->p_right_ || root->p_right_ == nil_))
     return 0;
   else if ((!root->p_left_) ^ (!root->p_right_ || root->p_right_ == nil_))
@@ -228,8 +237,8 @@ int Tree<K, T>::number_of_child(TreeNode<K, T> *root) const {
   return 2;
 }
 
-template <typename K, typename T>
-void Tree<K, T>::erase(typename Tree<K, T>::Iterator pos) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::erase(typename Tree<K, T, Update>::Iterator pos) {
     TreeNode<K, T>* del = pos.node_;
     if (!(--size_)) {
         clear();
@@ -248,16 +257,17 @@ void Tree<K, T>::erase(typename Tree<K, T>::Iterator pos) {
 }
 
 
-template <typename K, typename T>
-void Tree<K, T>::swap_node(TreeNode<K, T>* del, TreeNode<K, T>* next) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::swap_node(TreeNode<K, T>* del, TreeNode<K, T>* next) {
     delete_one_child(next);
     del->data_->first = next->data_->first;
     del->data_->second = next->data_->second;
+    UpdatePath(del);
     delete next;
 }
 
-template <typename K, typename T>
-void Tree<K, T>::replace_node(TreeNode<K, T>* node, TreeNode<K, T>* child) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::replace_node(TreeNode<K, T>* node, TreeNode<K, T>* child) {
     if (node->p_parent_->p_left_ && node == node->p_parent_->p_left_) {
         if (child) child->p_parent_ = node->p_parent_;
         node->p_parent_->p_left_ = child;
@@ -268,8 +278,8 @@ void Tree<K, T>::replace_node(TreeNode<K, T>* node, TreeNode<K, T>* child) {
     if (node->p_left_ && node->p_right_ == nil_) child->p_right_ = nil_;
 }
 
-template <typename K, typename T>
-void Tree<K, T>::delete_one_child(TreeNode<K, T>* node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::delete_one_child(TreeNode<K, T>* node) {
     TreeNode<K, T>* child = node->left_or_rigth();
     if ((!child || child == nil_) && node->color_ == kBlack) delete_case1(node);
     replace_node(node, child);
@@ -280,15 +290,16 @@ void Tree<K, T>::delete_one_child(TreeNode<K, T>* node) {
             delete_case1(child);
         }
     }
+    UpdatePath(node->p_parent_);
 }
 
-template <typename K, typename T>
-void Tree<K, T>::delete_case1(TreeNode<K, T>* node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::delete_case1(TreeNode<K, T>* node) {
     if (node->p_parent_) delete_case2(node);
 }
 
-template <typename K, typename T>
-void Tree<K, T>::delete_case2(TreeNode<K, T>* node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::delete_case2(TreeNode<K, T>* node) {
     TreeNode<K, T>* bro = Brother(node);
     if (bro->color_ == kRed) {
         node->p_parent_->color_ = kRed;
@@ -301,8 +312,8 @@ void Tree<K, T>::delete_case2(TreeNode<K, T>* node) {
     delete_case3(node);
 }
 
-template <typename K, typename T>
-void Tree<K, T>::delete_case3(TreeNode<K, T> *node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::delete_case3(TreeNode<K, T> *node) {
   TreeNode<K, T> *bro = Brother(node);
   if ((node->p_parent_->color_ == kBlack) && (bro->color_ == kBlack) &&
       (!bro->p_left_ || bro->p_left_->color_ == kBlack) &&
@@ -314,8 +325,8 @@ void Tree<K, T>::delete_case3(TreeNode<K, T> *node) {
   }
 }
 
-template <typename K, typename T>
-void Tree<K, T>::delete_case4(TreeNode<K, T> *node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::delete_case4(TreeNode<K, T> *node) {
   TreeNode<K, T> *bro = Brother(node);
   if ((node->p_parent_->color_ == kRed) && (bro->color_ == kBlack) &&
       (!bro->p_left_ || bro->p_left_->color_ == kBlack) &&
@@ -327,8 +338,8 @@ void Tree<K, T>::delete_case4(TreeNode<K, T> *node) {
   }
 }
 
-template <typename K, typename T>
-void Tree<K, T>::delete_case5(TreeNode<K, T>* node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::delete_case5(TreeNode<K, T>* node) {
     TreeNode<K, T>* bro = Brother(node);
     if (bro->color_ == kBlack) {
         if ((node == node->p_parent_->p_left_) &&
@@ -347,8 +358,8 @@ void Tree<K, T>::delete_case5(TreeNode<K, T>* node) {
     delete_case6(node);
 }
 
-template <typename K, typename T>
-void Tree<K, T>::delete_case6(TreeNode<K, T>* node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::delete_case6(TreeNode<K, T>* node) {
     TreeNode<K, T>* bro = Brother(node);
     bro->color_ = node->p_parent_->color_;
     node->p_parent_->color_ = kBlack;
@@ -361,8 +372,18 @@ void Tree<K, T>::delete_case6(TreeNode<K, T>* node) {
     }
 }
 
-template <typename K, typename T>
-void Tree<K, T>::print_N(TreeNode<K, T>* root) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::UpdatePath(TreeNode<K, T>* node) {
+    if constexpr (kAugmented) {
+        while (node) {
+            UpdateNode(node);
+            node = node->p_parent_;
+        }
+    }
+}
+
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::print_N(TreeNode<K, T>* root) {
     std::ofstream fout;
     fout.open("draw.dot", std::ios::app);
     if (root == nullptr) {
@@ -411,8 +432,8 @@ void Tree<K, T>::print_N(TreeNode<K, T>* root) {
     print_N(root->p_right_);
 }
 
-template <typename K, typename T>
-void Tree<K, T>::print() {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::print() {
     std::ofstream fout;
     fout.open("draw.dot");
     fout << "digraph G {\n";
@@ -423,8 +444,8 @@ void Tree<K, T>::print() {
     fout.close();
 }
 
-template <typename K, typename T>
-void Tree<K, T>::clean(TreeNode<K, T>* node) {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::clean(TreeNode<K, T>* node) {
     if (node) {
     clean(node->p_left_);
     clean(node->p_right_);
@@ -434,13 +455,14 @@ void Tree<K, T>::clean(TreeNode<K, T>* node) {
     size_ = 0;
 }
 
-template <typename K, typename T>
-void Tree<K, T>::clear() {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::clear() {
     clean(root_);
+    nil_ = nullptr;
 }
 
-template <typename K, typename T>
-typename Tree<K, T>::Iterator Tree<K, T>::begin() const {
+template <typename K, typename T, typename Update>
+typename Tree<K, T, Update>::Iterator Tree<K, T, Update>::begin() const {
     Iterator it;
     if (root_) {
         it.node_ = root_->MinimalNode();
@@ -448,8 +470,8 @@ typename Tree<K, T>::Iterator Tree<K, T>::begin() const {
     return it;
 }
 
-template <typename K, typename T>
-typename Tree<K, T>::Iterator Tree<K, T>::end() const {
+template <typename K, typename T, typename Update>
+typename Tree<K, T, Update>::Iterator Tree<K, T, Update>::end() const {
     Iterator it;
     if (root_) {
         it.node_ = nil_;
@@ -457,16 +479,16 @@ typename Tree<K, T>::Iterator Tree<K, T>::end() const {
     return it;
 }
 
-template <typename K, typename T>
-void Tree<K, T>::swap(Tree<K, T>& other) {
-    Tree<K, T> tmp(*this);
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::swap(Tree<K, T, Update>& other) {
+    Tree<K, T, Update> tmp(*this);
     *this = std::move(other);
     other = std::move(tmp);
 }
 
-template <typename K, typename T>
-void Tree<K, T>::merge(Tree<K, T>* other, bool is_set) {
-    Tree<K, T> tmp(*other);
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::merge(Tree<K, T, Update>* other, bool is_set) {
+    Tree<K, T, Update> tmp(*other);
     int pos = 0;
     for (auto &&value : tmp) {
         if (is_set) {
@@ -488,9 +510,9 @@ void Tree<K, T>::merge(Tree<K, T>* other, bool is_set) {
     }
 }
 
-template <typename K, typename T>
-std::pair<typename Tree<K, T>::Iterator, bool> Tree<K, T>::FindContains(const K& key) {
-    std::pair<typename Tree<K, T>::Iterator, bool> result;
+template <typename K, typename T, typename Update>
+std::pair<typename Tree<K, T, Update>::Iterator, bool> Tree<K, T, Update>::FindContains(const K& key) {
+    std::pair<typename Tree<K, T, Update>::Iterator, bool> result;
     result.second = false;
     TreeNode<K, T>* tmp = root_;
     while (tmp != nullptr && tmp != nil_) {
@@ -510,18 +532,94 @@ std::pair<typename Tree<K, T>::Iterator, bool> Tree<K, T>::FindContains(const K&
     return result;
 }
 
-template <typename K, typename T>
-typename Tree<K, T>::Iterator Tree<K, T>::find(const K& key) {
+template <typename K, typename T, typename Update>
+typename Tree<K, T, Update>::Iterator Tree<K, T, Update>::find(const K& key) {
     return FindContains(key).first;
 }
 
-template <typename K, typename T>
-bool Tree<K, T>::contains(const K& key) {
+template <typename K, typename T, typename Update>
+bool Tree<K, T, Update>::contains(const K& key) {
     return FindContains(key).second;
 }
 
-template <typename K, typename T>
-void Tree<K, T>::Iterator::operator++() {
+template <typename K, typename T, typename Update>
+typename Tree<K, T, Update>::Iterator Tree<K, T, Update>::LowerBoundFrom(Iterator hint, const K& key) const {
+    Iterator it;
+    if (root_ == nullptr) {
+        return it;
+    }
+    TreeNode<K, T>* node = hint.node_ ? hint.node_ : root_->MinimalNode();
+    if (node == nil_ || !(node->data_->first < key)) {
+        it.node_ = node;
+        return it;
+    }
+    // Finger search: climb until the subtree is bounded on the right by a key >= key,
+    // so the cost is logarithmic in the distance from hint rather than in size().
+    TreeNode<K, T>* bound = nil_;
+    while (node->p_parent_) {
+        TreeNode<K, T>* parent = node->p_parent_;
+        if (node == parent->p_left_ && !(parent->data_->first < key)) {
+            bound = parent;
+            break;
+        }
+        node = parent;
+    }
+    while (node != nullptr && node != nil_) {
+        if (node->data_->first < key) {
+            node = node->p_right_;
+        } else {
+            bound = node;
+            node = node->p_left_;
+        }
+    }
+    it.node_ = bound;
+    return it;
+}
+
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::assign_sorted(const K* keys, size_t count) {
+    assert(std::is_sorted(keys, keys + count) && "assign_sorted needs sorted keys");
+    clear();
+    if (count == 0) {
+        return;
+    }
+    size_t red_depth = 0;
+    for (size_t n = count; n > 1; n >>= 1) {
+        red_depth++;
+    }
+    root_ = BuildSorted(keys, count, 0, red_depth);
+    TreeNode<K, T>* max = root_->MaximalNode();
+    nil_ = new TreeNode<K, T>();
+    nil_->p_parent_ = max;
+    max->p_right_ = nil_;
+    size_ = count;
+}
+
+template <typename K, typename T, typename Update>
+TreeNode<K, T>* Tree<K, T, Update>::BuildSorted(const K* keys, size_t count, size_t depth, size_t red_depth) {
+    if (count == 0) {
+        return nullptr;
+    }
+    size_t mid = count / 2;
+    TreeNode<K, T>* node = new TreeNode<K, T>();
+    node->data_->first = keys[mid];
+    // Median splits keep every level above red_depth full, so only the deepest,
+    // possibly incomplete level is red and all black heights stay equal.
+    node->color_ = (depth > 0 && depth == red_depth) ? kRed : kBlack;
+    node->p_left_ = BuildSorted(keys, mid, depth + 1, red_depth);
+    node->p_right_ = BuildSorted(keys + mid + 1, count - mid - 1, depth + 1, red_depth);
+    if (node->p_left_) {
+        node->p_left_->p_parent_ = node;
+    }
+    if (node->p_right_) {
+        node->p_right_->p_parent_ = node;
+    }
+    UpdateNode(node);
+    return node;
+}
+
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::Iterator::operator++() {
     if (node_->NextNode()) {
         node_ = node_->NextNode();
     } else {
@@ -529,8 +627,8 @@ void Tree<K, T>::Iterator::operator++() {
     }
 }
 
-template <typename K, typename T>
-void Tree<K, T>::Iterator::operator--() {
+template <typename K, typename T, typename Update>
+void Tree<K, T, Update>::Iterator::operator--() {
     if (node_->PrevNode()) {
         node_ = node_->PrevNode();
     } else {
@@ -538,16 +636,16 @@ void Tree<K, T>::Iterator::operator--() {
     }
 }
 
-template <typename K, typename T>
-const K Tree<K, T>::Iterator::operator*() {
+template <typename K, typename T, typename Update>
+const K Tree<K, T, Update>::Iterator::operator*() {
     if (!node_) {
         throw std::out_of_range("ERROR: iterator is nullptr");
     }
     return node_->data_->first;
 }
 
-template <typename K, typename T>
-Tree<K, T>& Tree<K, T>::operator=(Tree<K, T>&& other) {
+template <typename K, typename T, typename Update>
+Tree<K, T, Update>& Tree<K, T, Update>::operator=(Tree<K, T, Update>&& other) {
     if (this == &other) {
         return *this;
     }
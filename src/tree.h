@@ -1,13 +1,25 @@
 #ifndef SRC_TREE_H_
 #define SRC_TREE_H_
+#include <algorithm>
+#include <cassert>
 #include <initializer_list>
 #include <limits>
+#include <type_traits>
 #include <utility>
 #include <exception>
 
 #include "treenode.h"
 namespace sfleta_ {
-template <typename K, typename T>
+// Node update policy of Tree: Update::update(node, nil) recomputes the summary
+// data of node from its own data and its children. It runs after every
+// structural change (rotations, insert, erase) so a tree can keep subtree
+// aggregates; the default keeps none and compiles the updates away.
+struct no_node_update {
+    template <typename Node>
+    static void update(Node*, const Node*) {}
+};
+
+template <typename K, typename T, typename Update = no_node_update>
 class Tree {
  protected:
     TreeNode<K, T>* root_;
@@ -38,6 +50,7 @@ class Tree {
     TreeNode<K, T>* next_elem(TreeNode<K, T>* root) const;
     int number_of_child(TreeNode<K, T>* root) const;
     void swap_node(TreeNode<K, T>* del, TreeNode<K, T>* next);
+    TreeNode<K, T>* BuildSorted(const K* keys, size_t count, size_t depth, size_t red_depth);
 
  public:
     class Iterator {
@@ -52,28 +65,42 @@ class Tree {
     };
     Tree() : root_(nullptr), size_(0), nil_(nullptr) {}
     explicit Tree(const std::initializer_list<K>& items);
-    Tree(const Tree<K, T>& t);
+    Tree(const Tree& t);
     ~Tree();
-    Tree<K, T>& operator=(Tree<K, T>&& other);
+    Tree& operator=(Tree&& other);
     Iterator begin() const;
     Iterator end() const;
     bool empty() { return !root_; }
     size_t size() { return size_; }
     size_t max_size() { return std::numeric_limits<size_t>::max() / sizeof(TreeNode<K, T>) / 2; }
-    void swap(Tree<K, T>& other);
-    void merge(Tree<K, T>* other, bool is_set);
+    void swap(Tree& other);
+    void merge(Tree* other, bool is_set);
     Iterator find(const K& key);
     bool contains(const K& key);
-    Iterator insert(const K& value);
+    Iterator insert(const K& value) { return InsertKey(value); }
+    Iterator insert(K&& value) { return InsertKey(std::move(value)); }
     void clear();
     void print();
     void erase(Iterator pos);
+    // keys must be in non-decreasing order; checked by assert in debug builds
+    void assign_sorted(const K* keys, size_t count);
+    Iterator LowerBound(const K& key) const { return LowerBoundFrom(begin(), key); }
+    Iterator LowerBoundFrom(Iterator hint, const K& key) const;
 
  protected:
     std::pair<Iterator, bool> FindContains(const K& key);
+    static constexpr bool kAugmented = !std::is_same_v<Update, no_node_update>;
+    void UpdateNode(TreeNode<K, T>* node) {
+        if constexpr (kAugmented) Update::update(node, nil_);
+    }
+    // updates node and all its ancestors
+    void UpdatePath(TreeNode<K, T>* node);
 
  private:
-    Iterator FindPlace(const K& value);
+    template <typename V>
+    Iterator InsertKey(V&& value);
+    template <typename V>
+    Iterator FindPlace(V&& value);
 };
 
 }  // namespace sfleta_